@@ -440,7 +440,7 @@ action_t::action_t( action_e ty, const std::string& token, player_t* p, const sp
     early_chain_if_expr(),
     cancel_if_expr( nullptr ),
     sync_action(),
-    signature_str(),
+    signature_str( util::share_text( std::string() ) ),
     target_specific_dot( false ),
     action_list(),
     starved_proc(),
@@ -454,7 +454,9 @@ action_t::action_t( action_e ty, const std::string& token, player_t* p, const sp
     target_cache(),
     options(),
     state_cache(),
-    travel_events()
+    travel_events(),
+    shared_snapshot(),
+    aoe_states()
 {
   assert( option.cycle_targets == 0 );
   assert( !name_str.empty() && "Abilities must have valid name_str entries!!" );
@@ -806,7 +808,7 @@ void action_t::parse_target_str()
         target = p;
       else
         sim->errorf( "%s %s: Unable to locate target for action '%s'.\n", player->name(), name(),
-                     signature_str.c_str() );
+                     signature_str -> c_str() );
     }
   }
 }
@@ -1360,7 +1362,7 @@ size_t action_t::available_targets( std::vector<player_t*>& tl ) const
 
   if ( sim->debug && !sim->distance_targeting_enabled )
   {
-    sim->print_debug("{} regenerated target cache for {} ({})", player->name(), signature_str, name() );
+    sim->print_debug("{} regenerated target cache for {} ({})", player->name(), *signature_str, name() );
     for ( size_t i = 0; i < tl.size(); i++ )
     {
       sim->print_debug( "[{:n}, {} (id={})]", i, tl[ i ]->name(), tl[ i ]->actor_index );
@@ -1373,12 +1375,12 @@ size_t action_t::available_targets( std::vector<player_t*>& tl ) const
 std::vector<player_t*>& action_t::target_list() const
 {
   // Check if target cache is still valid. If not, recalculate it
-  if ( !target_cache.is_valid )
+  if ( !target_cache.valid() )
   {
     available_targets( target_cache.list );  // This grabs the full list of targets, which will also pickup various
                                              // awfulness that some classes have.. such as prismatic crystal.
     check_distance_targeting( target_cache.list );
-    target_cache.is_valid = true;
+    target_cache.validate();
   }
 
   return target_cache.list;
@@ -1506,6 +1508,14 @@ void action_t::execute()
     std::vector<player_t*>& tl = target_list();
     num_targets                = ( n_targets() < 0 ) ? tl.size() : std::min( tl.size(), as<size_t>( n_targets() ) );
 
+    // Take ownership of the scratch buffer, so that a recursive execute of this action (through
+    // impacts) cannot clobber the states that are yet to be dispatched.
+    std::vector<action_state_t*> states;
+    states.swap( aoe_states );
+    states.clear();
+
+    // Snapshot, roll and compute all targets before dispatching any impacts. The player-side state
+    // is snapshotted for the first target, and shared by the rest of them.
     for ( size_t t = 0, max_targets = tl.size(); t < num_targets && t < max_targets; t++ )
     {
       action_state_t* s = get_state( pre_execute_state );
@@ -1515,6 +1525,14 @@ void action_t::execute()
       if ( !pre_execute_state )
       {
         snapshot_state( s, amount_type( s ) );
+        if ( t == 0 )
+        {
+          shared_snapshot.flags = snapshot_flags & ( STATE_CRIT | STATE_HASTE | STATE_AP | STATE_SP );
+          shared_snapshot.crit_chance = s->crit_chance;
+          shared_snapshot.haste = s->haste;
+          shared_snapshot.attack_power = s->attack_power;
+          shared_snapshot.spell_power = s->spell_power;
+        }
       }
       // Even if pre-execute state is defined, we need to snapshot target-specific state variables
       // for aoe spells.
@@ -1530,8 +1548,18 @@ void action_t::execute()
       if ( sim->debug )
         s->debug();
 
+      states.push_back( s );
+    }
+
+    shared_snapshot.flags = 0;
+
+    for ( auto s : states )
+    {
       schedule_travel( s );
     }
+
+    states.clear();
+    states.swap( aoe_states );
   }
   else  // single target
   {
@@ -1597,13 +1625,13 @@ void action_t::execute()
       // "On spell cast", only performed for foreground actions
       if ( ( pt2 = execute_state->cast_proc_type2() ) != PROC2_INVALID )
       {
-        action_callback_t::trigger( player->callbacks.procs[ pt ][ pt2 ], this, execute_state );
+        player->callbacks.trigger( pt, pt2, this, execute_state );
       }
 
       // "On an execute result"
       if ( ( pt2 = execute_state->execute_proc_type2() ) != PROC2_INVALID )
       {
-        action_callback_t::trigger( player->callbacks.procs[ pt ][ pt2 ], this, execute_state );
+        player->callbacks.trigger( pt, pt2, this, execute_state );
       }
     }
   }
@@ -2232,6 +2260,11 @@ bool action_t::ready()
   return true;
 }
 
+void action_t::rename( const std::string& name )
+{
+  player->action_index.rename( player->action_list, this, name );
+}
+
 void action_t::init()
 {
   if ( initialized )
@@ -3615,6 +3648,24 @@ void action_t::snapshot_internal( action_state_t* state, unsigned flags, dmg_e r
 
   state->result_type = rt;
 
+  // Player-side state shared by all targets of an aoe execute
+  if ( unsigned shared = flags & shared_snapshot.flags )
+  {
+    if ( shared & STATE_CRIT )
+      state->crit_chance = shared_snapshot.crit_chance;
+
+    if ( shared & STATE_HASTE )
+      state->haste = shared_snapshot.haste;
+
+    if ( shared & STATE_AP )
+      state->attack_power = shared_snapshot.attack_power;
+
+    if ( shared & STATE_SP )
+      state->spell_power = shared_snapshot.spell_power;
+
+    flags &= ~shared;
+  }
+
   if ( flags & STATE_CRIT )
     state->crit_chance = composite_crit_chance() * composite_crit_chance_multiplier();
 
@@ -4157,7 +4208,8 @@ void action_t::acquire_target( retarget_event_e /* event */, player_t* /* contex
 
 void action_t::activate()
 {
-  sim->target_non_sleeping_list.register_callback( [this]( player_t* ) { target_cache.is_valid = false; } );
+  target_cache.source_epoch = &sim->target_non_sleeping_epoch;
+  target_cache.is_valid = false;
 }
 
 // Change the target of the action, may require invalidation of target cache
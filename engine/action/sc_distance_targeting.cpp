@@ -38,26 +38,22 @@ bool action_t::execute_targeting( action_t* action ) const
   return true;
 }
 
-// This returns a list of all targets currently in range. 
-std::vector<player_t*> action_t::targets_in_range_list(
+// This filters the given list down to all targets currently in range, preserving the order of the
+// remaining targets.
+std::vector<player_t*>& action_t::targets_in_range_list(
     std::vector<player_t*>& tl ) const
 {
-  size_t i = tl.size();
-  while ( i > 0 )
-  {
-    i--;
-    player_t* target_ = tl[ i ];
+  tl.erase( std::remove_if( tl.begin(), tl.end(), [ this ]( player_t* target_ ) {
     if ( range > 0.0 && player->get_player_distance( *target_ ) > range )
     {
-      tl.erase( tl.begin() + i );
-    }
-    else if ( !ground_aoe && target_->debuffs.invulnerable && target_->debuffs.invulnerable->check() )
-    {
-      // Cannot target invulnerable mobs, unless it's a ground aoe. It just
-      // won't do damage.
-      tl.erase( tl.begin() + i );
+      return true;
     }
-  }
+
+    // Cannot target invulnerable mobs, unless it's a ground aoe. It just
+    // won't do damage.
+    return !ground_aoe && target_->debuffs.invulnerable && target_->debuffs.invulnerable->check();
+  } ), tl.end() );
+
   return tl;
 }
 
@@ -66,73 +62,66 @@ std::vector<player_t*>& action_t::check_distance_targeting(
 {
   if ( sim -> distance_targeting_enabled )
   {
-    size_t i = tl.size();
-    while ( i > 0 )
-    {
-      i--;
-      player_t* t = tl[i];
-      if ( t != target )
+    // Single pass, order preserving filter of the targets out of range
+    tl.erase( std::remove_if( tl.begin(), tl.end(), [ this ]( player_t* t ) {
+      if ( t == target )
       {
-        if ( sim->log )
-        {
-          sim->out_debug.printf(
-            "%s action %s - Range %.3f, Radius %.3f, player location "
-            "x=%.3f,y=%.3f, original target: %s - location: x=%.3f,y=%.3f, "
-            "impact target: %s - location: x=%.3f,y=%.3f",
-            player->name(), name(), range, radius, player->x_position,
-            player->y_position, target->name(), target->x_position,
-            target->y_position, t->name(), t->x_position, t->y_position );
-        }
-        if ( ( ground_aoe && t->debuffs.flying && t->debuffs.flying->check() ) )
-        {
-          tl.erase( tl.begin() + i );
-        }
-        else if ( radius > 0 && range > 0 )
-        {  // Abilities with range/radius radiate from the target.
-          if ( ground_aoe && parent_dot && parent_dot->is_ticking() )
-          {  // We need to check the parents dot for location.
-            if ( sim->log )
-              sim->out_debug.printf( "parent_dot location: x=%.3f,y%.3f",
-                                     parent_dot->state->original_x,
-                                     parent_dot->state->original_y );
-            if ( t->get_ground_aoe_distance( *parent_dot->state ) >
-                 radius + t->combat_reach )
-            {
-              tl.erase( tl.begin() + i );
-            }
-          }
-          else if ( ground_aoe && execute_state )
-          {
-            if ( t->get_ground_aoe_distance( *execute_state ) >
-                 radius + t->combat_reach )
-            {
-              tl.erase( tl.begin() + i );  // We should just check the child.
-            }
-          }
-          else if ( t->get_player_distance( *target ) > radius )
-          {
-            tl.erase( tl.begin() + i );
-          }
-        }  // If they do not have a range, they are likely based on the distance
-           // from the player.
-        else if ( radius > 0 &&
-                  t->get_player_distance( *player ) > radius + t->combat_reach )
-        {
-          tl.erase( tl.begin() + i );
+        return false;
+      }
+
+      if ( sim->log )
+      {
+        sim->out_debug.printf(
+          "%s action %s - Range %.3f, Radius %.3f, player location "
+          "x=%.3f,y=%.3f, original target: %s - location: x=%.3f,y=%.3f, "
+          "impact target: %s - location: x=%.3f,y=%.3f",
+          player->name(), name(), range, radius, player->x_position,
+          player->y_position, target->name(), target->x_position,
+          target->y_position, t->name(), t->x_position, t->y_position );
+      }
+      if ( ( ground_aoe && t->debuffs.flying && t->debuffs.flying->check() ) )
+      {
+        return true;
+      }
+      else if ( radius > 0 && range > 0 )
+      {  // Abilities with range/radius radiate from the target.
+        if ( ground_aoe && parent_dot && parent_dot->is_ticking() )
+        {  // We need to check the parents dot for location.
+          if ( sim->log )
+            sim->out_debug.printf( "parent_dot location: x=%.3f,y%.3f",
+                                   parent_dot->state->original_x,
+                                   parent_dot->state->original_y );
+          return t->get_ground_aoe_distance( *parent_dot->state ) >
+                 radius + t->combat_reach;
         }
-        else if ( range > 0 &&
-                  t->get_player_distance( *player ) > range + t->combat_reach )
+        else if ( ground_aoe && execute_state )
         {
-          // If they only have a range, then they are a single target ability, or
-          // are also based on the distance from the player.
-          tl.erase( tl.begin() + i );
+          // We should just check the child.
+          return t->get_ground_aoe_distance( *execute_state ) >
+                 radius + t->combat_reach;
         }
+
+        return t->get_player_distance( *target ) > radius;
+      }  // If they do not have a range, they are likely based on the distance
+         // from the player.
+      else if ( radius > 0 )
+      {
+        return t->get_player_distance( *player ) > radius + t->combat_reach;
       }
-    }
+      else if ( range > 0 )
+      {
+        // If they only have a range, then they are a single target ability, or
+        // are also based on the distance from the player.
+        return t->get_player_distance( *player ) > range + t->combat_reach;
+      }
+
+      return false;
+    } ), tl.end() );
+
     if ( sim->log )
     {
       sim->out_debug.printf( "%s regenerated target cache for %s (%s)",
-                             player->name(), signature_str.c_str(), name() );
+                             player->name(), signature_str->c_str(), name() );
       for ( size_t j = 0; j < tl.size(); j++ )
       {
         sim->out_debug.printf( "[%u, %s (id=%u) x= %.3f y= %.3f ]",
@@ -164,29 +153,27 @@ player_t* action_t::select_target_if_target()
     return target;
   }
 
-  std::vector<player_t*> master_list;
+  // Iterate the cached target list directly, instead of copying it for every evaluation
+  const std::vector<player_t*>* master_list;
   if ( sim->distance_targeting_enabled )
   {
-    if ( !target_cache.is_valid )
+    if ( !target_cache.valid() )
     {
       available_targets( target_cache.list );
-      master_list           = targets_in_range_list( target_cache.list );
-      target_cache.is_valid = true;
-    }
-    else
-    {
-      master_list = target_cache.list;
+      targets_in_range_list( target_cache.list );
+      target_cache.validate();
     }
+    master_list = &target_cache.list;
     if ( sim->log )
       sim->out_debug.printf( "%s Number of targets found in range - %.3f",
                              player->name(),
-                             static_cast<double>( master_list.size() ) );
-    if ( master_list.size() <= 1 )
+                             static_cast<double>( master_list->size() ) );
+    if ( master_list->size() <= 1 )
       return target;
   }
   else
   {
-    master_list = target_list();
+    master_list = &target_list();
   }
 
   player_t* original_target = target;
@@ -196,7 +183,7 @@ player_t* action_t::select_target_if_target()
   double max_ = current_target_v;
   double min_ = current_target_v;
 
-  for ( auto player : master_list )
+  for ( auto player : *master_list )
   {
     target = player;
 
@@ -244,7 +231,7 @@ player_t* action_t::select_target_if_target()
     if ( sim->debug )
     {
       sim->out_debug.printf( "%s target_if no target found for %s", player->name(),
-          signature_str.c_str() );
+          signature_str->c_str() );
     }
     return nullptr;
   }
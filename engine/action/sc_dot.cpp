@@ -150,6 +150,27 @@ void dot_t::reduce_duration( timespan_t remove_seconds, uint32_t state_flags )
   current_action->stats->add_refresh( state->target );
 }
 
+// dot_t::delay_tick ========================================================
+
+/* Push the next tick and the end of the dot back by the given amount of time. The tick is
+ * rescheduled through schedule_tick_event(), so with coalesce_dot_ticks only this dot leaves its
+ * tick batch.
+ */
+void dot_t::delay_tick( timespan_t delay )
+{
+  if ( !ticking || !tick_event )
+    return;
+
+  timespan_t time_to_next = tick_event->remains() + delay;
+  cancel_tick_event();
+  schedule_tick_event( time_to_next );
+
+  if ( end_event )
+  {
+    end_event->reschedule( end_event->remains() + delay );
+  }
+}
+
 // dot_t::refresh_duration ==================================================
 
 void dot_t::refresh_duration( uint32_t state_flags )
@@ -176,7 +197,7 @@ void dot_t::reset()
   if ( ticking )
     source->remove_active_dot( state->action->internal_id );
 
-  event_t::cancel( tick_event );
+  cancel_tick_event();
   event_t::cancel( end_event );
   time_to_tick     = timespan_t::zero();
   ticking          = false;
@@ -313,7 +334,7 @@ void dot_t::copy( player_t* other_target, dot_copy_e copy_type ) const
 
       // Cancel target's ongoing events, we are about to re-do them
       event_t::cancel( other_dot->end_event );
-      event_t::cancel( other_dot->tick_event );
+      other_dot->cancel_tick_event();
     }
     // No target dot ticking, just copy the source's remaining time
     else
@@ -374,8 +395,7 @@ void dot_t::copy( player_t* other_target, dot_copy_e copy_type ) const
     else
       tick_time = other_dot->current_action->tick_time( other_dot->state );
 
-    other_dot->tick_event =
-        make_event<dot_tick_event_t>( sim, other_dot, tick_time );
+    other_dot->schedule_tick_event( tick_time );
   }
 }
 
@@ -419,7 +439,7 @@ void dot_t::copy( dot_t* other_dot ) const
 
     // Cancel target's ongoing events, we are about to re-do them
     event_t::cancel( other_dot->end_event );
-    event_t::cancel( other_dot->tick_event );
+    other_dot->cancel_tick_event();
   }
   // No target dot ticking, just copy the source's remaining time
   else
@@ -479,7 +499,7 @@ void dot_t::copy( dot_t* other_dot ) const
   else
     tick_time = other_dot->current_action->tick_time( other_dot->state );
 
-  other_dot->tick_event = make_event<dot_tick_event_t>( sim, other_dot, tick_time );
+  other_dot->schedule_tick_event( tick_time );
 }
 
 // dot_t::create_expression =================================================
@@ -1075,6 +1095,81 @@ void dot_t::last_tick()
   }
 }
 
+/* Schedule the tick event of the dot. With coalesce_dot_ticks, the tick joins a pending batch
+ * event of the source due on the same timestamp, or starts a new one.
+ */
+void dot_t::schedule_tick_event( timespan_t time_to_tick )
+{
+  if ( !sim.coalesce_dot_ticks )
+  {
+    tick_event = make_event<dot_tick_event_t>( sim, this, time_to_tick );
+    return;
+  }
+
+  timespan_t tick_at = sim.current_time() + time_to_tick;
+  auto it = range::find_if( source->dot_tick_batches,
+                            [tick_at]( const dot_tick_batch_event_t* e ) { return e->occurs() == tick_at; } );
+
+  dot_tick_batch_event_t* batch;
+  if ( it != source->dot_tick_batches.end() )
+  {
+    batch = *it;
+  }
+  else
+  {
+    batch = make_event<dot_tick_batch_event_t>( sim, source, time_to_tick );
+    source->dot_tick_batches.push_back( batch );
+  }
+
+  if ( sim.debug )
+    sim.out_debug.printf( "New DoT Tick: %s %s %d-of-%d %.4f (batch of %u)", source->name(), name(),
+                          current_tick + 1, num_ticks, time_to_tick.total_seconds(),
+                          as<unsigned>( batch->dots.size() + 1 ) );
+
+  batch->dots.push_back( this );
+  tick_event = batch;
+}
+
+void dot_t::cancel_tick_event()
+{
+  if ( !tick_event )
+  {
+    return;
+  }
+
+  if ( !sim.coalesce_dot_ticks )
+  {
+    event_t::cancel( tick_event );
+    return;
+  }
+
+  // Batches stay registered on the source until they are recycled. If the batch is no longer
+  // registered, it has been flushed at the end of the iteration and there is nothing to cancel.
+  auto batch = static_cast<dot_tick_batch_event_t*>( tick_event );
+  tick_event = nullptr;
+
+  auto it = range::find( source->dot_tick_batches, batch );
+  if ( it == source->dot_tick_batches.end() )
+  {
+    return;
+  }
+
+  auto dot_it = range::find( batch->dots, this );
+  if ( dot_it == batch->dots.end() )
+  {
+    return;
+  }
+
+  *dot_it = nullptr;
+
+  if ( !batch->executing && range::find_if( batch->dots, []( const dot_t* d ) { return d != nullptr; } ) == batch->dots.end() )
+  {
+    source->dot_tick_batches.erase( it );
+    event_t* e = batch;
+    event_t::cancel( e );
+  }
+}
+
 void dot_t::schedule_tick()
 {
   if ( remains() == timespan_t::zero() )
@@ -1097,7 +1192,7 @@ void dot_t::schedule_tick()
   last_tick_factor =
       current_action->last_tick_factor( this, base_tick_time, remains() );
 
-  tick_event = make_event<dot_tick_event_t>( sim, this, time_to_tick );
+  schedule_tick_event( time_to_tick );
 
   if ( current_action->channeled )
   {
@@ -1106,7 +1201,7 @@ void dot_t::schedule_tick()
       if ( current_action->sim->debug )
       {
         current_action->sim->out_debug.print( "{} '{}' cancel_if returns {}, cancelling channel",
-          current_action->player->name(), current_action->signature_str,
+          current_action->player->name(), *current_action->signature_str,
           current_action->cancel_if_expr->eval() );
       }
       cancel();
@@ -1173,7 +1268,7 @@ void dot_t::start( timespan_t duration )
   // Only schedule a tick if thre's enough time to tick at least once.
   // Otherwise, next tick is the last tick, and the end event will handle it
   if ( current_duration <= time_to_tick )
-    event_t::cancel( tick_event );
+    cancel_tick_event();
 }
 
 /* Precondition: ticking == true
@@ -1220,7 +1315,7 @@ void dot_t::refresh( timespan_t duration )
   if ( !tick_event )
   {
     assert( !current_action->channeled );
-    tick_event = make_event<dot_tick_event_t>( sim, this, remaining_duration );
+    schedule_tick_event( remaining_duration );
   }
 
   // When refreshing DoTs before the partial last tick on expiry,
@@ -1230,8 +1325,8 @@ void dot_t::refresh( timespan_t duration )
   timespan_t next_tick_in = next_tick_at - sim.current_time();
   if ( !current_action -> channeled && remaining_duration < next_tick_in )
   {
-    event_t::cancel( tick_event );
-    tick_event = make_event<dot_tick_event_t>( sim, this, next_tick_in );
+    cancel_tick_event();
+    schedule_tick_event( next_tick_in );
     if ( sim.debug )
       sim.out_debug.printf(
         "%s reschedules next tick (was a partial) for dot %s (%d) on %s to happen in %.3f at %.3f.",
@@ -1290,7 +1385,7 @@ bool dot_t::is_higher_priority_action_available() const
   if ( action && action->internal_id != current_action->internal_id && player->sim->debug )
   {
     player->sim->out_debug.print( "{} action available for context {}: {}", player->name(),
-      current_action->signature_str, action->signature_str );
+      *current_action->signature_str, *action->signature_str );
   }
   return action != nullptr && action->internal_id != current_action->internal_id;
 }
@@ -1321,12 +1416,12 @@ void dot_t::adjust( double coefficient )
         ( sim->current_time() + new_dot_remains ).total_seconds() );
   }
 
-  event_t::cancel( tick_event );
+  cancel_tick_event();
   event_t::cancel( end_event );
 
   current_duration = new_duration;
   time_to_tick     = time_to_tick * coefficient;
-  tick_event       = make_event<dot_tick_event_t>( *sim, this, new_tick_remains );
+  schedule_tick_event( new_tick_remains );
   //end_event        = new ( *sim ) dot_end_event_t( this, new_dot_remains );
   end_event = make_event<dot_end_event_t>(*sim, this, new_dot_remains );
 }
@@ -1372,12 +1467,53 @@ void dot_t::adjust_full_ticks( double coefficient )
         ( sim->current_time() + new_dot_remains ).total_seconds() );
   }
 
-  event_t::cancel( tick_event );
+  cancel_tick_event();
   event_t::cancel( end_event );
 
   current_duration = new_duration;
   time_to_tick     = new_time_to_tick;
-  tick_event       = make_event<dot_tick_event_t>( *sim, this, new_tick_remains );
+  schedule_tick_event( new_tick_remains );
   end_event        = make_event<dot_end_event_t>( *sim, this, new_dot_remains );
   num_ticks        = current_tick + rounded_full_ticks_left;
 }
+
+// ==========================================================================
+// DoT Tick Batch Event
+// ==========================================================================
+
+dot_tick_batch_event_t::dot_tick_batch_event_t( player_t* s, timespan_t time_to_tick ) :
+  event_t( *s, time_to_tick ),
+  source( s ),
+  executing( false )
+{ }
+
+dot_tick_batch_event_t::~dot_tick_batch_event_t()
+{
+  auto it = range::find( source->dot_tick_batches, this );
+  if ( it != source->dot_tick_batches.end() )
+  {
+    source->dot_tick_batches.erase( it );
+  }
+}
+
+// The batch stays registered on the source while executing, so ticks of later dots in the batch
+// can still be canceled. Ticks rescheduled during dispatch always land on a later timestamp, so
+// they never join this batch.
+void dot_tick_batch_event_t::execute()
+{
+  executing = true;
+
+  for ( size_t i = 0; i < dots.size(); ++i )
+  {
+    dot_t* dot = dots[ i ];
+    // Canceled by an earlier tick of this batch
+    if ( !dot )
+    {
+      continue;
+    }
+
+    dots[ i ] = nullptr;
+    dot->tick_event = nullptr;
+    dot->execute_tick();
+  }
+}
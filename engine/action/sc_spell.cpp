@@ -217,9 +217,8 @@ heal_t::heal_t( const std::string&  token,
 
 void heal_t::activate()
 {
-  sim -> player_non_sleeping_list.register_callback( [ this ]( player_t* ) {
-    target_cache.is_valid = false;
-  } );
+  target_cache.source_epoch = &sim -> player_non_sleeping_epoch;
+  target_cache.is_valid = false;
 }
 
 void heal_t::parse_effect_data( const spelleffect_data_t& e )
@@ -363,7 +362,7 @@ void heal_t::assess_damage( dmg_e heal_type, action_state_t* s )
     proc_types pt = s -> proc_type();
     proc_types2 pt2 = s -> impact_proc_type2();
     if ( pt != PROC1_INVALID && pt2 != PROC2_INVALID )
-      action_callback_t::trigger( player -> callbacks.procs[ pt ][ pt2 ], this, s );
+      player -> callbacks.trigger( pt, pt2, this, s );
   }
 
   if ( player -> record_healing() )
@@ -551,9 +550,8 @@ absorb_t::absorb_t( const std::string&  token,
 
 void absorb_t::activate()
 {
-  sim -> player_non_sleeping_list.register_callback( [ this ]( player_t* ) {
-    target_cache.is_valid = false;
-  } );
+  target_cache.source_epoch = &sim -> player_non_sleeping_epoch;
+  target_cache.is_valid = false;
 }
 
 void absorb_t::impact( action_state_t* s )
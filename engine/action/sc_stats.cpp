@@ -49,7 +49,7 @@ stats_t::stats_t( const std::string& n, player_t* p ) :
   portion_aps.reserve( size );
   portion_apse.reserve( size );
 
-  if ( sim.report_details != 0 )
+  if ( sim.report_details != 0 && sim.memory_budget_level < 1 )
   {
     timeline_amount = std::unique_ptr<sc_timeline_t>( new sc_timeline_t() );
   }
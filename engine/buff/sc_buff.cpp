@@ -502,6 +502,7 @@ buff_t::buff_t( sim_t* sim, player_t* target, player_t* source, const std::strin
     overridden(),
     can_cancel( true ),
     requires_invalidation(),
+    dirty( true ),
     reverse_stack_reduction( 1 ),
     current_value(),
     current_stack(),
@@ -547,6 +548,7 @@ buff_t::buff_t( sim_t* sim, player_t* target, player_t* source, const std::strin
   if ( source )  // Player Buffs
   {
     player->buff_list.push_back( this );
+    player->dirty_buff_list.push_back( this );
     cooldown = source->get_cooldown( "buff_" + name_str );
   }
   else  // Sim Buffs
@@ -702,7 +704,8 @@ buff_t* buff_t::set_max_stack( int max_stack )
   stack_react_time.resize( _max_stack + 1 );
   stack_react_ready_triggers.resize( _max_stack + 1 );
 
-  if ( as<int>( stack_uptime.size() ) < _max_stack + 1 )
+  // Per-stack uptimes are only collected at the full buff statistics level
+  if ( sim->buff_statistics_level >= 2 && as<int>( stack_uptime.size() ) < _max_stack + 1 )
   {
     stack_uptime.resize( _max_stack + 1 );
   }
@@ -963,7 +966,7 @@ void buff_t::datacollection_begin()
   overflow_count                       = 0;
   overflow_total                       = 0;
 
-  for ( int i = 0; i <= simulation_max_stack; i++ )
+  for ( int i = 0; i <= simulation_max_stack && i < as<int>( stack_uptime.size() ); i++ )
     stack_uptime[ i ].datacollection_begin();
 }
 
@@ -983,9 +986,14 @@ void buff_t::datacollection_end()
 
   uptime_pct.add( time != timespan_t::zero() ? 100.0 * iteration_uptime_sum / time : 0 );
 
-  for ( int i = 0; i <= simulation_max_stack; i++ )
+  for ( int i = 0; i <= simulation_max_stack && i < as<int>( stack_uptime.size() ); i++ )
     stack_uptime[ i ].datacollection_end( time );
 
+  if ( sim->buff_statistics_level < 1 )
+  {
+    return;
+  }
+
   if ( up_count > 0 )
   {
     benefit_pct.add( 100.0 * up_count / ( up_count + down_count ) );
@@ -1216,7 +1224,10 @@ bool buff_t::trigger( int stacks, double value, double chance, timespan_t durati
       d.value = value;
     }
     else
+    {
+      touch();
       delay = make_event<buff_delay_t>( *sim, this, stacks, value, duration );
+    }
   }
   else
     execute( stacks, value, duration );
@@ -1226,10 +1237,12 @@ bool buff_t::trigger( int stacks, double value, double chance, timespan_t durati
 
 void buff_t::execute( int stacks, double value, timespan_t duration )
 {
+  touch();
+
   if ( value == DEFAULT_VALUE() && default_value != DEFAULT_VALUE() )
     value = default_value;
 
-  if ( last_trigger > timespan_t::zero() )
+  if ( last_trigger > timespan_t::zero() && sim->buff_statistics_level >= 2 )
   {
     trigger_intervals.add( ( sim->current_time() - last_trigger ).total_seconds() );
   }
@@ -1385,6 +1398,8 @@ void buff_t::start( int stacks, double value, timespan_t duration )
   if ( _max_stack == 0 )
     return;
 
+  touch();
+
 #ifndef NDEBUG
   if ( stack_behavior != buff_stack_behavior::ASYNCHRONOUS && current_stack != 0 )
   {
@@ -1429,7 +1444,7 @@ void buff_t::start( int stacks, double value, timespan_t duration )
 
   bump( stacks, value );
 
-  if ( last_start >= timespan_t::zero() )
+  if ( last_start >= timespan_t::zero() && sim->buff_statistics_level >= 2 )
   {
     start_intervals.add( ( sim->current_time() - last_start ).total_seconds() );
   }
@@ -1544,6 +1559,8 @@ void buff_t::bump( int stacks, double value )
   if ( _max_stack == 0 )
     return;
 
+  touch();
+
   bool haste_to_be_adjusted = false; // Flag to check if we need to adjust haste at the end of bump
 
   if ( value != current_value )
@@ -1552,7 +1569,9 @@ void buff_t::bump( int stacks, double value )
   }
   current_value = value;
 
-  if ( requires_invalidation )
+  // Only invalidate when the effective value of the buff changes. Refreshing a buff at max stacks
+  // with the same value leaves all dependent stats untouched.
+  if ( requires_invalidation && ( haste_to_be_adjusted || max_stack() < 0 || current_stack < max_stack() ) )
     invalidate_cache();
 
   int old_stack = current_stack;
@@ -1604,7 +1623,7 @@ void buff_t::bump( int stacks, double value )
       }
     }
 
-    if ( before_stack != current_stack )
+    if ( before_stack != current_stack && !stack_uptime.empty() )
     {
       stack_uptime[ before_stack ].update( false, sim->current_time() );
       stack_uptime[ current_stack ].update( true, sim->current_time() );
@@ -1676,6 +1695,8 @@ void buff_t::override_buff( int stacks, double value )
   if ( _max_stack == 0 )
     return;
 
+  touch();
+
 #ifndef NDEBUG
   if ( current_stack != 0 )
   {
@@ -1728,8 +1749,11 @@ void buff_t::expire( timespan_t delay )
   }
   event_t::cancel( tick_event );
 
-  assert( as<std::size_t>( current_stack ) < stack_uptime.size() );
-  stack_uptime[ current_stack ].update( false, sim->current_time() );
+  if ( !stack_uptime.empty() )
+  {
+    assert( as<std::size_t>( current_stack ) < stack_uptime.size() );
+    stack_uptime[ current_stack ].update( false, sim->current_time() );
+  }
 
   if ( player && change_regen_rate )
     player->do_dynamic_regen();
@@ -1850,19 +1874,49 @@ void buff_t::reset()
   last_stack_change = timespan_t::min();
 }
 
-void buff_t::merge( const buff_t& other )
+/**
+ * Register the buff in the actor's per-iteration dirty set, on the first state change of the
+ * iteration. Only buffs in the dirty set are reset at the end of the iteration. Sim-wide buffs
+ * are always reset, and are permanently flagged dirty.
+ */
+void buff_t::touch()
+{
+  if ( !dirty )
+  {
+    dirty = true;
+    player->dirty_buff_list.push_back( this );
+  }
+}
+
+/// Is the buff in the state buff_t::reset() leaves it in
+bool buff_t::is_reset() const
 {
-  start_intervals.merge( other.start_intervals );
-  trigger_intervals.merge( other.trigger_intervals );
+  return current_stack == 0 && expiration.empty() && !delay && !expiration_delay && !tick_event &&
+         last_start == timespan_t::min() && last_trigger == timespan_t::min() &&
+         last_stack_change == timespan_t::min();
+}
 
+void buff_t::merge( const buff_t& other )
+{
   uptime_pct.merge( other.uptime_pct );
-  benefit_pct.merge( other.benefit_pct );
-  trigger_pct.merge( other.trigger_pct );
-  avg_start.merge( other.avg_start );
-  avg_refresh.merge( other.avg_refresh );
-  avg_expire.merge( other.avg_expire );
-  avg_overflow_count.merge( other.avg_overflow_count );
-  avg_overflow_total.merge( other.avg_overflow_total );
+
+  if ( sim->buff_statistics_level >= 1 )
+  {
+    benefit_pct.merge( other.benefit_pct );
+    trigger_pct.merge( other.trigger_pct );
+    avg_start.merge( other.avg_start );
+    avg_refresh.merge( other.avg_refresh );
+    avg_expire.merge( other.avg_expire );
+    avg_overflow_count.merge( other.avg_overflow_count );
+    avg_overflow_total.merge( other.avg_overflow_total );
+  }
+
+  if ( sim->buff_statistics_level >= 2 )
+  {
+    start_intervals.merge( other.start_intervals );
+    trigger_intervals.merge( other.trigger_intervals );
+  }
+
   if ( sim->buff_uptime_timeline )
     uptime_array.merge( other.uptime_array );
 
@@ -2022,7 +2076,8 @@ buff_t* buff_t::find( sim_t* s, const std::string& name )
 
 buff_t* buff_t::find( player_t* p, const std::string& name, player_t* source )
 {
-  return find( p->buff_list, name, source );
+  return p->buff_index.find( p->buff_list, name,
+                             [source]( const buff_t* b ) { return !source || source == b->source; } );
 }
 
 std::string buff_t::source_name() const
@@ -2412,7 +2467,11 @@ void absorb_buff_t::start( int stacks, double value, timespan_t duration )
   assert( range::find( player->absorb_buff_list, this ) == player->absorb_buff_list.end() &&
           "Attempting to add absorb buff to absorb_buffs list twice" );
 
-  player->absorb_buff_list.push_back( this );
+  // Keep the active absorbs in consumption order, so damage absorption does not need to sort them
+  // on every hit. Absorbs are consumed in name order, absorbs of the same name in start order.
+  auto it = std::upper_bound( player->absorb_buff_list.begin(), player->absorb_buff_list.end(), this,
+                              []( const absorb_buff_t* a, const absorb_buff_t* b ) { return a->name_str < b->name_str; } );
+  player->absorb_buff_list.insert( it, this );
 }
 
 void absorb_buff_t::expire_override( int expiration_stacks, timespan_t remaining_duration )
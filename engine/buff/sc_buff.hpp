@@ -75,6 +75,7 @@ public:
   bool reactable;
   bool reverse, constant, quiet, overridden, can_cancel;
   bool requires_invalidation;
+  bool dirty; /// Buff changed state during the current iteration, and needs to be reset
 
   int reverse_stack_reduction; /// Number of stacks reduced when reverse = true
 
@@ -237,6 +238,8 @@ public:
   virtual void expire_override( int /* expiration_stacks */, timespan_t /* remaining_duration */ ) {}
   virtual void predict();
   virtual void reset();
+  void touch();
+  bool is_reset() const;
   virtual void aura_gain();
   virtual void aura_loss();
   virtual void merge( const buff_t& other_buff );
@@ -142,7 +142,7 @@ struct enemy_action_t : public ACTION_TYPE
 
   virtual void set_name_string()
   {
-    this -> name_str = this -> name_str + "_" + this -> target -> name();
+    this -> rename( this -> name_str + "_" + this -> target -> name() );
   }
 
   // this is only used by helper structures
@@ -490,7 +490,7 @@ struct auto_attack_t : public enemy_action_t<attack_t>
   virtual void set_name_string() override
   {
     if ( mh_list.size() > 1 )
-      this -> name_str = this -> name_str + "_tanks";
+      this -> rename( this -> name_str + "_tanks" );
     else
       base_t::set_name_string();
   }
@@ -1020,11 +1020,9 @@ public:
       auto first_pet = p -> owner -> find_pet( p -> name_str );
       if ( first_pet != nullptr && first_pet != p )
       {
-        auto it = range::find( p -> stats_list, ab::stats );
-        if ( it != p -> stats_list.end() )
+        // The stats object is owned by the pet's arena, it is released with the pet
+        if ( p -> stats_index.erase( p -> stats_list, ab::stats ) )
         {
-          p -> stats_list.erase( it );
-          delete ab::stats;
           ab::stats = first_pet -> get_stats( ab::name_str, this );
         }
       }
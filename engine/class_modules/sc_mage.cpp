@@ -4428,7 +4428,7 @@ void report_burn_switch_error( action_t* a )
 {
   throw std::runtime_error(
     fmt::format( "{} action {} infinite loop detected (no time passing between executes) at '{}'",
-                 a->player->name(), a->name(), a->signature_str ) );
+                 a->player->name(), a->name(), *a->signature_str ) );
 }
 
 struct start_burn_phase_t : public action_t
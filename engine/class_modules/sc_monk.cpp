@@ -3442,15 +3442,9 @@ struct windwalking_aura_t : public monk_spell_t
 
   std::vector<player_t*>& check_distance_targeting( std::vector<player_t*>& tl ) const override
   {
-    size_t i = tl.size();
-    while ( i > 0 )
-    {
-      i--;
-      player_t* target_to_buff = tl[ i ];
-
-      if ( p()->get_player_distance( *target_to_buff ) > 10.0 )
-        tl.erase( tl.begin() + i );
-    }
+    tl.erase( std::remove_if( tl.begin(), tl.end(), [ this ]( player_t* target_to_buff ) {
+      return p()->get_player_distance( *target_to_buff ) > 10.0;
+    } ), tl.end() );
 
     return tl;
   }
@@ -5636,18 +5630,7 @@ struct stagger_self_damage_t : public residual_action::residual_periodic_action_
 
   void delay_tick( timespan_t seconds )
   {
-    dot_t* d = get_dot();
-    if ( d->is_ticking() )
-    {
-      if ( d->tick_event )
-      {
-        d->tick_event->reschedule( d->tick_event->remains() + seconds );
-        if ( d->end_event )
-        {
-          d->end_event->reschedule( d->end_event->remains() + seconds );
-        }
-      }
-    }
+    get_dot()->delay_tick( seconds );
   }
 
   /* Clears the dot and all damage. Used by Purifying Brew
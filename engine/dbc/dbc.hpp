@@ -1576,7 +1576,7 @@ public:
   const item_armor_type_data_t&  item_armor_total( unsigned ilevel ) const;
   const item_armor_type_data_t&  item_armor_inv_type( unsigned inv_type ) const;
 
-  std::vector<const item_bonus_entry_t*> item_bonus( unsigned bonus_id ) const;
+  arv::array_view<const item_bonus_entry_t*> item_bonus( unsigned bonus_id ) const;
 
   // Derived data access
   unsigned class_ability( unsigned class_id, unsigned tree_id, unsigned n ) const;
@@ -1925,16 +1925,47 @@ spell_data_t* spell_data_t::find( unsigned spell_id, const char* confirmation, b
   return p;
 }
 
-spell_data_t* spell_data_t::find( const char* name, bool ptr )
+namespace
+{
+// Spell name index, each name maps to its first spell in table order
+std::unordered_map<std::string, spell_data_t*> build_spell_name_index( bool ptr )
 {
+  std::unordered_map<std::string, spell_data_t*> index;
+
   for ( spell_data_t* p = spell_data_t::list( ptr ); p -> name_cstr(); ++p )
   {
-    if ( ! strcmp ( name, p -> name_cstr() ) )
-    {
-      return p;
-    }
+    index.emplace( p -> name_cstr(), p );
   }
-  return nullptr;
+
+  return index;
+}
+
+// The index is built once per process on first use, function-local statics are initialized
+// thread-safely
+const std::unordered_map<std::string, spell_data_t*>& spell_name_index( bool ptr )
+{
+  if ( SC_USE_PTR && ptr )
+  {
+    static const auto index = build_spell_name_index( true );
+    return index;
+  }
+
+  static const auto index = build_spell_name_index( false );
+  return index;
+}
+} // unnamed namespace
+
+spell_data_t* spell_data_t::find( const char* name, bool ptr )
+{
+  const auto& index = spell_name_index( ptr );
+
+  auto it = index.find( name );
+  if ( it == index.end() )
+  {
+    return nullptr;
+  }
+
+  return it -> second;
 }
 
 // Always returns non-NULL
@@ -258,24 +258,66 @@ const item_armor_type_data_t& dbc_t::item_armor_total( unsigned ilevel ) const
 #endif
 }
 
-std::vector<const item_bonus_entry_t*> dbc_t::item_bonus( unsigned bonus_id ) const
+namespace
+{
+// Item bonus entries ordered by bonus id (and table order within a bonus id)
+std::vector<const item_bonus_entry_t*> build_item_bonus_index( const item_bonus_entry_t* p )
+{
+  std::vector<const item_bonus_entry_t*> index;
+
+  while ( p -> id != 0 )
+  {
+    index.push_back( p );
+    p++;
+  }
+
+  std::stable_sort( index.begin(), index.end(), []( const item_bonus_entry_t* l, const item_bonus_entry_t* r ) {
+    return l -> bonus_id < r -> bonus_id;
+  } );
+
+  return index;
+}
+
+// The index is built once per process on first use, function-local statics are initialized
+// thread-safely
+const std::vector<const item_bonus_entry_t*>& item_bonus_index( bool ptr )
 {
 #if SC_USE_PTR
-  const item_bonus_entry_t* p = ptr ? __ptr_item_bonus_data : __item_bonus_data;
+  if ( ptr )
+  {
+    static const auto index = build_item_bonus_index( __ptr_item_bonus_data );
+    return index;
+  }
 #else
-  const item_bonus_entry_t* p = __item_bonus_data;
+  ( void ) ptr;
 #endif
 
-  std::vector<const item_bonus_entry_t*> entries;
+  static const auto index = build_item_bonus_index( __item_bonus_data );
+  return index;
+}
 
-  while ( p -> id != 0 )
+struct bonus_id_compare_t
+{
+  bool operator()( const item_bonus_entry_t* e, unsigned bonus_id ) const
+  { return e -> bonus_id < bonus_id; }
+
+  bool operator()( unsigned bonus_id, const item_bonus_entry_t* e ) const
+  { return bonus_id < e -> bonus_id; }
+};
+} // unnamed namespace
+
+arv::array_view<const item_bonus_entry_t*> dbc_t::item_bonus( unsigned bonus_id ) const
+{
+  const auto& index = item_bonus_index( ptr );
+
+  auto range = std::equal_range( index.begin(), index.end(), bonus_id, bonus_id_compare_t() );
+  if ( range.first == range.second )
   {
-    if ( p -> bonus_id == bonus_id )
-      entries.push_back(p);
-    p++;
+    return {};
   }
 
-  return entries;
+  return arv::array_view<const item_bonus_entry_t*>( &( *range.first ),
+                                                     std::distance( range.first, range.second ) );
 }
 
 const item_enchantment_data_t& dbc_t::item_enchantment( unsigned enchant_id ) const
@@ -443,36 +485,98 @@ const scaling_stat_distribution_t* dbc_t::scaling_stat_distribution( unsigned id
   return nullptr;
 }
 
-std::pair<const curve_point_t*, const curve_point_t*> dbc_t::curve_point( unsigned curve_id, double value )
+namespace
+{
+// Points of each curve, in table order. Curves whose points are in ascending value order (all of
+// them in practice) are searched with binary search.
+struct curve_point_index_t
+{
+  struct curve_t
+  {
+    std::vector<const curve_point_t*> points;
+    bool sorted = true;
+  };
+
+  std::unordered_map<unsigned, curve_t> curves;
+
+  explicit curve_point_index_t( const curve_point_t* p )
+  {
+    for ( ; p -> curve_id != 0; ++p )
+    {
+      auto& curve = curves[ p -> curve_id ];
+      if ( ! curve.points.empty() && curve.points.back() -> val1 > p -> val1 )
+      {
+        curve.sorted = false;
+      }
+      curve.points.push_back( p );
+    }
+  }
+};
+
+// The index is built once per process on first use, function-local statics are initialized
+// thread-safely
+const curve_point_index_t& curve_point_index( bool ptr )
 {
 #if SC_USE_PTR
-  const curve_point_t* table = ptr ? &__ptr_curve_point_data[ 0 ]
-                                   : &__curve_point_data[ 0 ];
+  if ( ptr )
+  {
+    static const curve_point_index_t index( &__ptr_curve_point_data[ 0 ] );
+    return index;
+  }
 #else
-  const curve_point_t* table = &__curve_point_data[ 0 ];
+  ( void ) ptr;
 #endif
 
+  static const curve_point_index_t index( &__curve_point_data[ 0 ] );
+  return index;
+}
+} // unnamed namespace
+
+std::pair<const curve_point_t*, const curve_point_t*> dbc_t::curve_point( unsigned curve_id, double value )
+{
+  const auto& index = curve_point_index( ptr );
+
   const curve_point_t* lower_bound = nullptr, * upper_bound = nullptr;
-  while ( table -> curve_id != 0 )
+
+  auto it = index.curves.find( curve_id );
+  if ( it != index.curves.end() )
   {
-    if ( table -> curve_id != curve_id )
+    const auto& points = it -> second.points;
+    if ( it -> second.sorted )
     {
-      table++;
-      continue;
-    }
+      // First point at or above value, the bracketing point below it is its predecessor
+      auto upper = std::lower_bound( points.begin(), points.end(), value,
+          []( const curve_point_t* point, double v ) { return point -> val1 < v; } );
+      if ( upper != points.end() )
+      {
+        upper_bound = *upper;
+        if ( ( *upper ) -> val1 <= value )
+        {
+          lower_bound = *upper;
+        }
+      }
 
-    if ( table -> val1 <= value )
-    {
-      lower_bound = table;
+      if ( lower_bound == nullptr && upper != points.begin() )
+      {
+        lower_bound = *( upper - 1 );
+      }
     }
-
-    if ( table -> val1 >= value )
+    else
     {
-      upper_bound = table;
-      break;
-    }
+      for ( auto point : points )
+      {
+        if ( point -> val1 <= value )
+        {
+          lower_bound = point;
+        }
 
-    table++;
+        if ( point -> val1 >= value )
+        {
+          upper_bound = point;
+          break;
+        }
+      }
+    }
   }
 
   if ( lower_bound == nullptr )
@@ -1383,7 +1487,7 @@ const item_data_t* dbc::find_consumable( item_subclass_consumable type, bool ptr
   return i ? i : &( nil_item_data );
 }
 
-static std::string get_bonus_id_desc( bool ptr, const std::vector<const item_bonus_entry_t*>& entries )
+static std::string get_bonus_id_desc( bool ptr, const arv::array_view<const item_bonus_entry_t*>& entries )
 {
   for ( size_t i = 0; i < entries.size(); ++i )
   {
@@ -1396,7 +1500,7 @@ static std::string get_bonus_id_desc( bool ptr, const std::vector<const item_bon
   return std::string();
 }
 
-static std::string get_bonus_id_suffix( bool ptr, const std::vector<const item_bonus_entry_t*>& entries )
+static std::string get_bonus_id_suffix( bool ptr, const arv::array_view<const item_bonus_entry_t*>& entries )
 {
   for ( size_t i = 0; i < entries.size(); ++i )
   {
@@ -1409,7 +1513,7 @@ static std::string get_bonus_id_suffix( bool ptr, const std::vector<const item_b
   return std::string();
 }
 
-static std::pair<std::pair<int, double>, std::pair<int, double> > get_bonus_id_scaling( dbc_t& dbc, const std::vector<const item_bonus_entry_t*>& entries )
+static std::pair<std::pair<int, double>, std::pair<int, double> > get_bonus_id_scaling( dbc_t& dbc, const arv::array_view<const item_bonus_entry_t*>& entries )
 {
   for ( size_t i = 0; i < entries.size(); ++i )
   {
@@ -1436,7 +1540,7 @@ static std::pair<std::pair<int, double>, std::pair<int, double> > get_bonus_id_s
   return std::pair<std::pair<int, double>, std::pair<int, double> >( std::pair<int, double>( -1, 0 ), std::pair<int, double>( -1, 0 ) );
 }
 
-static int get_bonus_id_ilevel( const std::vector<const item_bonus_entry_t*>& entries )
+static int get_bonus_id_ilevel( const arv::array_view<const item_bonus_entry_t*>& entries )
 {
   for ( size_t i = 0; i < entries.size(); ++i )
   {
@@ -1449,7 +1553,7 @@ static int get_bonus_id_ilevel( const std::vector<const item_bonus_entry_t*>& en
   return 0;
 }
 
-static int get_bonus_id_base_ilevel( const std::vector<const item_bonus_entry_t*>& entries )
+static int get_bonus_id_base_ilevel( const arv::array_view<const item_bonus_entry_t*>& entries )
 {
   for ( size_t i = 0; i < entries.size(); ++i )
   {
@@ -1462,7 +1566,7 @@ static int get_bonus_id_base_ilevel( const std::vector<const item_bonus_entry_t*
   return 0;
 }
 
-static std::string get_bonus_id_quality( const std::vector<const item_bonus_entry_t*>& entries )
+static std::string get_bonus_id_quality( const arv::array_view<const item_bonus_entry_t*>& entries )
 {
   for ( auto& entry : entries )
   {
@@ -1475,7 +1579,7 @@ static std::string get_bonus_id_quality( const std::vector<const item_bonus_entr
   return "";
 }
 
-static int get_bonus_id_sockets( const std::vector<const item_bonus_entry_t*>& entries )
+static int get_bonus_id_sockets( const arv::array_view<const item_bonus_entry_t*>& entries )
 {
   for ( size_t i = 0; i < entries.size(); ++i )
   {
@@ -1488,7 +1592,7 @@ static int get_bonus_id_sockets( const std::vector<const item_bonus_entry_t*>& e
   return 0;
 }
 
-static int get_bonus_power_index( const std::vector<const item_bonus_entry_t*>& entries )
+static int get_bonus_power_index( const arv::array_view<const item_bonus_entry_t*>& entries )
 {
   auto it = range::find_if( entries, []( const item_bonus_entry_t* entry ) {
     return entry -> type == ITEM_BONUS_ADD_RANK;
@@ -1503,7 +1607,7 @@ static int get_bonus_power_index( const std::vector<const item_bonus_entry_t*>&
 }
 
 static std::vector< std::tuple< item_mod_type, double, double > > get_bonus_id_stats(
-    const std::vector<const item_bonus_entry_t*>& entries )
+    const arv::array_view<const item_bonus_entry_t*>& entries )
 {
   double total = 0;
 
@@ -1570,7 +1674,7 @@ std::string dbc::bonus_ids_str( dbc_t& dbc)
 
   for ( size_t i = 0; i < bonus_ids.size(); ++i )
   {
-    std::vector<const item_bonus_entry_t*> entries = dbc.item_bonus( bonus_ids[ i ] );
+    auto entries = dbc.item_bonus( bonus_ids[ i ] );
     std::string desc = get_bonus_id_desc( dbc.ptr, entries );
     std::string suffix = get_bonus_id_suffix( dbc.ptr, entries );
     std::string quality = get_bonus_id_quality( entries );
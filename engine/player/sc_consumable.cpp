@@ -339,7 +339,7 @@ struct dbc_consumable_base_t : public action_t
       catch (const std::exception&)
       {
         std::throw_with_nested( std::invalid_argument(fmt::format("Unable to initialize consumable '{}' from '{}'",
-            signature_str, consumable_name)));
+            *signature_str, consumable_name)));
       }
     }
 
@@ -302,7 +302,7 @@ void enchant::initialize_item_enchant( item_t& item,
       }
       case ITEM_ENCHANTMENT_APPLY_BONUS:
       {
-        std::vector<const item_bonus_entry_t*> bonuses = item.player -> dbc.item_bonus( enchant.ench_prop[ i ] );
+        auto bonuses = item.player -> dbc.item_bonus( enchant.ench_prop[ i ] );
         for ( auto bonus : bonuses )
         {
           item_database::apply_item_bonus( item, *bonus );
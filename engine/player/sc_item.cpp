@@ -53,7 +53,7 @@ bool item_t::has_scaling_stat_bonus_id() const
 {
   for ( auto bonus_id : parsed.bonus_id )
   {
-    std::vector<const item_bonus_entry_t*> bonuses = player -> dbc.item_bonus( bonus_id );
+    auto bonuses = player -> dbc.item_bonus( bonus_id );
     if ( std::find_if( bonuses.begin(), bonuses.end(), []( const item_bonus_entry_t* e )
           { return e -> type == ITEM_BONUS_SCALING; } ) != bonuses.end() )
     {
@@ -540,7 +540,7 @@ std::string item_t::full_name() const
 
   for ( auto bonus_id : parsed.bonus_id )
   {
-    std::vector<const item_bonus_entry_t*> bonuses = sim -> dbc.item_bonus( bonus_id );
+    auto bonuses = sim -> dbc.item_bonus( bonus_id );
     for ( const auto bonus : bonuses )
     {
       if ( bonus -> type != ITEM_BONUS_SUFFIX )
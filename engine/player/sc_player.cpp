@@ -62,7 +62,7 @@ bool prune_specialized_execute_actions_internal( std::vector<action_t*>& apl, ex
       if ( !state )
       {
         alist->player->sim->print_debug( "{} pruning {} from APL ({})",
-          alist->player->name(), (*it)->signature_str,
+          alist->player->name(), *(*it)->signature_str,
           e == execute_type::OFF_GCD ? "off-gcd" : "cast-while-casting" );
         it = apl.erase( it );
       }
@@ -1101,6 +1101,9 @@ player_t::player_t( sim_t* s, player_e t, const std::string& n, race_e r ):
   actor_index = sim->actor_list.size();
   sim->actor_list.push_back( this );
 
+  // Class module static data and the special effect database are registered on first use
+  sim->startup_time += unique_gear::init_special_effects( type );
+
   if ( !is_enemy() && !is_pet() && type != HEALING_ENEMY )
   {
     artifact = artifact::player_artifact_data_t::create( this );
@@ -2593,7 +2596,7 @@ void player_t::create_actions()
 
     for ( auto& action_priority : apl->action_list )
     {
-      std::string& action_str = action_priority.action_;
+      const std::string& action_str = *action_priority.action_;
 
       std::string::size_type cut_pt = action_str.find( ',' );
       std::string action_name       = action_str.substr( 0, cut_pt );
@@ -2620,8 +2623,8 @@ void player_t::create_actions()
         {
           sim->print_debug( "{}: modify_action={}", *this, modify_action );
 
-          action_options = modify_action_options;
-          action_str     = modify_action + "," + modify_action_options;
+          action_options          = modify_action_options;
+          action_priority.action_ = util::share_text( modify_action + "," + modify_action_options );
         }
         a = create_action( action_name, action_options );
       }
@@ -2629,7 +2632,7 @@ void player_t::create_actions()
       if ( !a )
       {
         throw std::invalid_argument(
-            fmt::format("{} unable to create action: {}", *this, action_str));
+            fmt::format("{} unable to create action: {}", *this, *action_priority.action_));
       }
 
       bool skip = false;
@@ -2651,7 +2654,7 @@ void player_t::create_actions()
         // a -> action_list = action_priority_list[ alist ] -> name_str;
         a->action_list = apl;
 
-        a->signature_str = action_str;
+        a->signature_str = action_priority.action_;
         a->signature     = &( action_priority );
 
         if ( sim->separate_stats_by_actions > 0 && !is_pet() )
@@ -2670,7 +2673,7 @@ void player_t::create_actions()
     }
   }
 
-  if ( !is_add() && ( !is_pet() || sim->report_pets_separately ) )
+  if ( sim->record_action_sequence && !is_add() && ( !is_pet() || sim->report_pets_separately ) )
   {
     int capacity = std::max( 1200, static_cast<int>( sim->max_time.total_seconds() / 2.0 ) );
     collected_data.action_sequence.reserve( capacity );
@@ -2860,7 +2863,7 @@ void player_t::init_assessors()
     proc_types pt   = state->proc_type();
     proc_types2 pt2 = state->impact_proc_type2();
     if ( pt != PROC1_INVALID && pt2 != PROC2_INVALID )
-      action_callback_t::trigger( callbacks.procs[ pt ][ pt2 ], state->action, state );
+      callbacks.trigger( pt, pt2, state->action, state );
 
     return assessor::CONTINUE;
   } );
@@ -4284,6 +4287,9 @@ void invalidate_cache( cache_e )
 
 void player_t::sequence_add_wait( const timespan_t& amount, const timespan_t& ts )
 {
+  if ( !sim->record_action_sequence )
+    return;
+
   // Collect iteration#1 data, for log/debug/iterations==1 simulation iteration#0 data
   if ( ( sim->iterations <= 1 && sim->current_iteration == 0 ) ||
        ( sim->iterations > 1 && nth_iteration() == 1 ) )
@@ -4311,6 +4317,9 @@ void player_t::sequence_add_wait( const timespan_t& amount, const timespan_t& ts
 
 void player_t::sequence_add( const action_t* a, const player_t* target, const timespan_t& ts )
 {
+  if ( !sim->record_action_sequence )
+    return;
+
   // Collect iteration#1 data, for log/debug/iterations==1 simulation iteration#0 data
   if ( ( a->sim->iterations <= 1 && a->sim->current_iteration == 0 ) ||
        ( a->sim->iterations > 1 && nth_iteration() == 1 ) )
@@ -4719,6 +4728,8 @@ void player_t::merge( player_t& other )
     iteration_resource_gained[ i ] += other.iteration_resource_gained[ i ];
   }
 
+  cache.merge( other.cache );
+
   buff_merge::merge( *this, other );
 
   // Procs
@@ -4824,9 +4835,9 @@ void player_t::merge( player_t& other )
       sim->error(
           "{} can't merge action {}::{} with {}::{} because ids do not match.", *this,
           action_list[ i ]->action_list ? action_list[ i ]->action_list->name_str.c_str() : "(none)",
-          action_list[ i ]->signature_str,
+          *action_list[ i ]->signature_str,
           other.action_list[ i ]->action_list ? other.action_list[ i ]->action_list->name_str.c_str() : "(none)",
-          other.action_list[ i ]->signature_str );
+          *other.action_list[ i ]->signature_str );
     }
   }
 }
@@ -4857,8 +4868,23 @@ void player_t::reset()
 
   sim->print_debug( "{} resets current stats ( reset to initial ): {}", *this, current.to_string() );
 
+  // Only buffs that changed state during the iteration need to be reset. Debug builds verify that
+  // the rest of the buffs are already in their reset state. Resetting a buff may touch others, so
+  // iterate by index.
+#ifndef NDEBUG
   for ( auto& buff : buff_list )
+  {
+    assert( buff->dirty || buff->is_reset() );
+  }
+#endif
+
+  for ( size_t i = 0; i < dirty_buff_list.size(); ++i )
+  {
+    buff_t* buff = dirty_buff_list[ i ];
+    buff->dirty = false;
     buff->reset();
+  }
+  dirty_buff_list.clear();
 
   last_foreground_action = nullptr;
   prev_gcd_actions.clear();
@@ -6205,17 +6231,6 @@ void account_blessing_of_sacrifice( player_t& p, action_state_t* s )
   }
 }
 
-bool absorb_sort( absorb_buff_t* a, absorb_buff_t* b )
-{
-  double lv = a->current_value, rv = a->current_value;
-  if ( lv == rv )
-  {
-    return a->name_str < b->name_str;
-  }
-
-  return lv < rv;
-}
-
 void account_absorb_buffs( player_t& p, action_state_t* s, school_e school )
 {
   /* ABSORB BUFFS
@@ -6301,10 +6316,8 @@ void account_absorb_buffs( player_t& p, action_state_t* s, school_e school )
       }
     }
 
-    // Second, we handle any low priority absorbs. These absorbs obey the rule of "smallest first".
-
-    // Sort the absorbs by size, then we can loop through them in order.
-    range::sort( p.absorb_buff_list, absorb_sort );
+    // Second, we handle any low priority absorbs. The list is kept ordered by
+    // absorb_buff_t::start(), so we can loop through them in order.
     size_t offset = 0;
 
     while ( offset < p.absorb_buff_list.size() && s->result_amount > 0 && !p.absorb_buff_list.empty() )
@@ -6494,7 +6507,7 @@ void player_t::do_damage( action_state_t* incoming_state )
     // On damage/heal in. Proc flags are arranged as such that the "incoming"
     // version of the primary proc flag is always follows the outgoing version.
     if ( pt != PROC1_INVALID && pt2 != PROC2_INVALID )
-      action_callback_t::trigger( callbacks.procs[ pt + 1 ][ pt2 ], incoming_state->action, incoming_state );
+      callbacks.trigger( static_cast<proc_types>( pt + 1 ), pt2, incoming_state->action, incoming_state );
   }
 
   // Check if target is dying
@@ -6655,13 +6668,7 @@ bool player_t::recent_cast() const
 
 dot_t* player_t::find_dot( const std::string& name, player_t* source ) const
 {
-  for ( size_t i = 0; i < dot_list.size(); ++i )
-  {
-    dot_t* d = dot_list[ i ];
-    if ( d->source == source && d->name_str == name )
-      return d;
-  }
-  return nullptr;
+  return dot_index.find( dot_list, name, [source]( const dot_t* d ) { return d->source == source; } );
 }
 
 void player_t::clear_action_priority_lists() const
@@ -6717,17 +6724,17 @@ pet_t* player_t::find_pet( const std::string& name ) const
 
 stats_t* player_t::find_stats( const std::string& name ) const
 {
-  return find_vector_member( stats_list, name );
+  return stats_index.find( stats_list, name );
 }
 
 gain_t* player_t::find_gain( const std::string& name ) const
 {
-  return find_vector_member( gain_list, name );
+  return gain_index.find( gain_list, name );
 }
 
 proc_t* player_t::find_proc( const std::string& name ) const
 {
-  return find_vector_member( proc_list, name );
+  return proc_index.find( proc_list, name );
 }
 
 luxurious_sample_data_t* player_t::find_sample_data( const std::string& name ) const
@@ -6747,12 +6754,12 @@ uptime_t* player_t::find_uptime( const std::string& name ) const
 
 cooldown_t* player_t::find_cooldown( const std::string& name ) const
 {
-  return find_vector_member( cooldown_list, name );
+  return cooldown_index.find( cooldown_list, name );
 }
 
 action_t* player_t::find_action( const std::string& name ) const
 {
-  return find_vector_member( action_list, name );
+  return action_index.find( action_list, name );
 }
 
 cooldown_t* player_t::get_cooldown( const std::string& name, action_t* a )
@@ -6761,7 +6768,7 @@ cooldown_t* player_t::get_cooldown( const std::string& name, action_t* a )
 
   if ( !c )
   {
-    c = new cooldown_t( name, *this );
+    c = arena.create<cooldown_t>( name, *this );
 
     cooldown_list.push_back( c );
   }
@@ -6782,7 +6789,7 @@ real_ppm_t* player_t::get_rppm( const std::string& name, const spell_data_t* dat
     return *it;
   }
 
-  real_ppm_t* new_rppm = new real_ppm_t( name, this, data, item );
+  real_ppm_t* new_rppm = arena.create<real_ppm_t>( name, this, data, item );
   rppm_list.push_back( new_rppm );
 
   return new_rppm;
@@ -6798,7 +6805,7 @@ real_ppm_t* player_t::get_rppm( const std::string& name, double freq, double mod
     return *it;
   }
 
-  real_ppm_t* new_rppm = new real_ppm_t( name, this, freq, mod, s );
+  real_ppm_t* new_rppm = arena.create<real_ppm_t>( name, this, freq, mod, s );
   rppm_list.push_back( new_rppm );
 
   return new_rppm;
@@ -6815,7 +6822,7 @@ shuffled_rng_t* player_t::get_shuffled_rng( const std::string& name, int success
     return *it;
   }
 
-  shuffled_rng_t* new_shuffled_rng = new shuffled_rng_t( name, this, success_entries, total_entries );
+  shuffled_rng_t* new_shuffled_rng = arena.create<shuffled_rng_t>( name, this, success_entries, total_entries );
   shuffled_rng_list.push_back( new_shuffled_rng );
 
   return new_shuffled_rng;
@@ -6827,7 +6834,7 @@ dot_t* player_t::get_dot( const std::string& name, player_t* source )
 
   if ( !d )
   {
-    d = new dot_t( name, this, source );
+    d = arena.create<dot_t>( name, this, source );
     dot_list.push_back( d );
   }
 
@@ -6840,7 +6847,7 @@ gain_t* player_t::get_gain( const std::string& name )
 
   if ( !g )
   {
-    g = new gain_t( name );
+    g = arena.create<gain_t>( name );
 
     gain_list.push_back( g );
   }
@@ -6854,7 +6861,7 @@ proc_t* player_t::get_proc( const std::string& name )
 
   if ( !p )
   {
-    p = new proc_t( *sim, name );
+    p = arena.create<proc_t>( *sim, name );
 
     proc_list.push_back( p );
   }
@@ -6868,7 +6875,7 @@ luxurious_sample_data_t* player_t::get_sample_data( const std::string& name )
 
   if ( !sd )
   {
-    sd = new luxurious_sample_data_t( *this, name );
+    sd = arena.create<luxurious_sample_data_t>( *this, name );
 
     sample_data_list.push_back( sd );
   }
@@ -6882,7 +6889,7 @@ stats_t* player_t::get_stats( const std::string& n, action_t* a )
 
   if ( !stats )
   {
-    stats = new stats_t( n, this );
+    stats = arena.create<stats_t>( n, this );
 
     stats_list.push_back( stats );
   }
@@ -6901,7 +6908,7 @@ benefit_t* player_t::get_benefit( const std::string& name )
 
   if ( !u )
   {
-    u = new benefit_t( *sim, name );
+    u = arena.create<benefit_t>( *sim, name );
 
     benefit_list.push_back( u );
   }
@@ -6915,7 +6922,7 @@ uptime_t* player_t::get_uptime( const std::string& name )
 
   if ( !u )
   {
-    u = new uptime_t( *sim, name );
+    u = arena.create<uptime_t>( *sim, name );
 
     uptime_list.push_back( u );
   }
@@ -7410,7 +7417,7 @@ struct variable_t : public action_t
       {
         sim->print_debug( "{} removing variable action {} from APL because the variable value is "
                           "constant (value={})",
-            player->name(), signature_str, var->current_value_ );
+            player->name(), *signature_str, var->current_value_ );
 
         action_list->foreground_action_list.erase( it );
       }
@@ -7505,7 +7512,7 @@ struct variable_t : public action_t
     if ( sim->debug && operation != OPERATION_PRINT )
     {
       sim->out_debug.printf( "%s variable name=%s op=%d value=%f default=%f sig=%s", player->name(), var->name_.c_str(),
-                             operation, var->current_value_, var->default_, signature_str.c_str() );
+                             operation, var->current_value_, var->default_, signature_str->c_str() );
     }
 
     switch ( operation )
@@ -8173,7 +8180,7 @@ struct use_item_t : public action_t
         return;
       }
 
-      name_str = name_str + "_" + item_name;
+      rename( name_str + "_" + item_name );
     }
     else if ( !item_slot.empty() )
     {
@@ -8200,7 +8207,7 @@ struct use_item_t : public action_t
       }
       else
       {
-        name_str = name_str + "_" + item->name();
+        rename( name_str + "_" + item->name() );
       }
     }
     else if ( !effect_name.empty() )
@@ -8217,7 +8224,7 @@ struct use_item_t : public action_t
         return;
       }
 
-      name_str = name_str + "_" + item->name();
+      rename( name_str + "_" + item->name() );
     }
     else
     {
@@ -10852,9 +10859,9 @@ std::string player_t::create_profile( save_e stype )
         bool first = true;
         for ( const auto& action : apl->action_list )
         {
-          if ( !action.comment_.empty() )
+          if ( !action.comment_->empty() )
           {
-            profile_str += "# " + action.comment_ + term;
+            profile_str += "# " + *action.comment_ + term;
           }
 
           profile_str += "actions";
@@ -10864,7 +10871,7 @@ std::string player_t::create_profile( save_e stype )
           }
 
           profile_str += first ? "=" : "+=/";
-          profile_str += action.action_ + term;
+          profile_str += *action.action_ + term;
 
           first = false;
         }
@@ -11681,6 +11688,7 @@ void player_stat_cache_t::invalidate_all()
   range::fill( spell_power_valid, false );
   range::fill( player_mult_valid, false );
   range::fill( player_heal_mult_valid, false );
+  range::for_each( generation, []( uint64_t& g ) { ++g; } );
 }
 
 /**
@@ -11688,6 +11696,8 @@ void player_stat_cache_t::invalidate_all()
  */
 void player_stat_cache_t::invalidate( cache_e c )
 {
+  ++generation[ c ];
+
   switch ( c )
   {
     case CACHE_SPELL_POWER:
@@ -11705,6 +11715,19 @@ void player_stat_cache_t::invalidate( cache_e c )
   }
 }
 
+/**
+ * Accumulate cache statistics of the same actor in another (thread) sim.
+ */
+void player_stat_cache_t::merge( const player_stat_cache_t& other )
+{
+  for ( size_t i = 0; i < CACHE_MAX; ++i )
+  {
+    generation[ i ] += other.generation[ i ];
+    accesses[ i ] += other.accesses[ i ];
+    misses[ i ] += other.misses[ i ];
+  }
+}
+
 /**
  * Get access attribute cache functions by attribute-enumeration.
  */
@@ -11733,8 +11756,10 @@ double player_stat_cache_t::get_attribute( attribute_e a ) const
 
 double player_stat_cache_t::strength() const
 {
+  ++accesses[ CACHE_STRENGTH ];
   if ( !active || !valid[ CACHE_STRENGTH ] )
   {
+    ++misses[ CACHE_STRENGTH ];
     valid[ CACHE_STRENGTH ] = true;
     _strength               = player->strength();
   }
@@ -11745,8 +11770,10 @@ double player_stat_cache_t::strength() const
 
 double player_stat_cache_t::agility() const
 {
+  ++accesses[ CACHE_AGILITY ];
   if ( !active || !valid[ CACHE_AGILITY ] )
   {
+    ++misses[ CACHE_AGILITY ];
     valid[ CACHE_AGILITY ] = true;
     _agility               = player->agility();
   }
@@ -11757,8 +11784,10 @@ double player_stat_cache_t::agility() const
 
 double player_stat_cache_t::stamina() const
 {
+  ++accesses[ CACHE_STAMINA ];
   if ( !active || !valid[ CACHE_STAMINA ] )
   {
+    ++misses[ CACHE_STAMINA ];
     valid[ CACHE_STAMINA ] = true;
     _stamina               = player->stamina();
   }
@@ -11769,8 +11798,10 @@ double player_stat_cache_t::stamina() const
 
 double player_stat_cache_t::intellect() const
 {
+  ++accesses[ CACHE_INTELLECT ];
   if ( !active || !valid[ CACHE_INTELLECT ] )
   {
+    ++misses[ CACHE_INTELLECT ];
     valid[ CACHE_INTELLECT ] = true;
     _intellect               = player->intellect();
   }
@@ -11781,8 +11812,10 @@ double player_stat_cache_t::intellect() const
 
 double player_stat_cache_t::spirit() const
 {
+  ++accesses[ CACHE_SPIRIT ];
   if ( !active || !valid[ CACHE_SPIRIT ] )
   {
+    ++misses[ CACHE_SPIRIT ];
     valid[ CACHE_SPIRIT ] = true;
     _spirit               = player->spirit();
   }
@@ -11793,8 +11826,10 @@ double player_stat_cache_t::spirit() const
 
 double player_stat_cache_t::spell_power( school_e s ) const
 {
+  ++accesses[ CACHE_SPELL_POWER ];
   if ( !active || !spell_power_valid[ s ] )
   {
+    ++misses[ CACHE_SPELL_POWER ];
     spell_power_valid[ s ] = true;
     _spell_power[ s ]      = player->composite_spell_power( s );
   }
@@ -11805,8 +11840,10 @@ double player_stat_cache_t::spell_power( school_e s ) const
 
 double player_stat_cache_t::attack_power() const
 {
+  ++accesses[ CACHE_ATTACK_POWER ];
   if ( !active || !valid[ CACHE_ATTACK_POWER ] )
   {
+    ++misses[ CACHE_ATTACK_POWER ];
     valid[ CACHE_ATTACK_POWER ] = true;
     _attack_power               = player->composite_melee_attack_power();
   }
@@ -11817,8 +11854,10 @@ double player_stat_cache_t::attack_power() const
 
 double player_stat_cache_t::attack_expertise() const
 {
+  ++accesses[ CACHE_ATTACK_EXP ];
   if ( !active || !valid[ CACHE_ATTACK_EXP ] )
   {
+    ++misses[ CACHE_ATTACK_EXP ];
     valid[ CACHE_ATTACK_EXP ] = true;
     _attack_expertise         = player->composite_melee_expertise();
   }
@@ -11829,8 +11868,10 @@ double player_stat_cache_t::attack_expertise() const
 
 double player_stat_cache_t::attack_hit() const
 {
+  ++accesses[ CACHE_ATTACK_HIT ];
   if ( !active || !valid[ CACHE_ATTACK_HIT ] )
   {
+    ++misses[ CACHE_ATTACK_HIT ];
     valid[ CACHE_ATTACK_HIT ] = true;
     _attack_hit               = player->composite_melee_hit();
   }
@@ -11847,8 +11888,10 @@ double player_stat_cache_t::attack_hit() const
 
 double player_stat_cache_t::attack_crit_chance() const
 {
+  ++accesses[ CACHE_ATTACK_CRIT_CHANCE ];
   if ( !active || !valid[ CACHE_ATTACK_CRIT_CHANCE ] )
   {
+    ++misses[ CACHE_ATTACK_CRIT_CHANCE ];
     valid[ CACHE_ATTACK_CRIT_CHANCE ] = true;
     _attack_crit_chance               = player->composite_melee_crit_chance();
   }
@@ -11859,8 +11902,10 @@ double player_stat_cache_t::attack_crit_chance() const
 
 double player_stat_cache_t::attack_haste() const
 {
+  ++accesses[ CACHE_ATTACK_HASTE ];
   if ( !active || !valid[ CACHE_ATTACK_HASTE ] )
   {
+    ++misses[ CACHE_ATTACK_HASTE ];
     valid[ CACHE_ATTACK_HASTE ] = true;
     _attack_haste               = player->composite_melee_haste();
   }
@@ -11871,8 +11916,10 @@ double player_stat_cache_t::attack_haste() const
 
 double player_stat_cache_t::attack_speed() const
 {
+  ++accesses[ CACHE_ATTACK_SPEED ];
   if ( !active || !valid[ CACHE_ATTACK_SPEED ] )
   {
+    ++misses[ CACHE_ATTACK_SPEED ];
     valid[ CACHE_ATTACK_SPEED ] = true;
     _attack_speed               = player->composite_melee_speed();
   }
@@ -11883,8 +11930,10 @@ double player_stat_cache_t::attack_speed() const
 
 double player_stat_cache_t::spell_hit() const
 {
+  ++accesses[ CACHE_SPELL_HIT ];
   if ( !active || !valid[ CACHE_SPELL_HIT ] )
   {
+    ++misses[ CACHE_SPELL_HIT ];
     valid[ CACHE_SPELL_HIT ] = true;
     _spell_hit               = player->composite_spell_hit();
   }
@@ -11895,8 +11944,10 @@ double player_stat_cache_t::spell_hit() const
 
 double player_stat_cache_t::spell_crit_chance() const
 {
+  ++accesses[ CACHE_SPELL_CRIT_CHANCE ];
   if ( !active || !valid[ CACHE_SPELL_CRIT_CHANCE ] )
   {
+    ++misses[ CACHE_SPELL_CRIT_CHANCE ];
     valid[ CACHE_SPELL_CRIT_CHANCE ] = true;
     _spell_crit_chance               = player->composite_spell_crit_chance();
   }
@@ -11907,8 +11958,10 @@ double player_stat_cache_t::spell_crit_chance() const
 
 double player_stat_cache_t::rppm_haste_coeff() const
 {
+  ++accesses[ CACHE_RPPM_HASTE ];
   if ( !active || !valid[ CACHE_RPPM_HASTE ] )
   {
+    ++misses[ CACHE_RPPM_HASTE ];
     valid[ CACHE_RPPM_HASTE ] = true;
     _rppm_haste_coeff          = 1.0 / std::min( player->cache.spell_haste(), player->cache.attack_haste() );
   }
@@ -11921,8 +11974,10 @@ double player_stat_cache_t::rppm_haste_coeff() const
 
 double player_stat_cache_t::rppm_crit_coeff() const
 {
+  ++accesses[ CACHE_RPPM_CRIT ];
   if ( !active || !valid[ CACHE_RPPM_CRIT ] )
   {
+    ++misses[ CACHE_RPPM_CRIT ];
     valid[ CACHE_RPPM_CRIT ] = true;
     _rppm_crit_coeff          = 1.0 + std::max( player->cache.attack_crit_chance(), player->cache.spell_crit_chance() );
   }
@@ -11935,8 +11990,10 @@ double player_stat_cache_t::rppm_crit_coeff() const
 
 double player_stat_cache_t::spell_haste() const
 {
+  ++accesses[ CACHE_SPELL_HASTE ];
   if ( !active || !valid[ CACHE_SPELL_HASTE ] )
   {
+    ++misses[ CACHE_SPELL_HASTE ];
     valid[ CACHE_SPELL_HASTE ] = true;
     _spell_haste               = player->composite_spell_haste();
   }
@@ -11947,8 +12004,10 @@ double player_stat_cache_t::spell_haste() const
 
 double player_stat_cache_t::spell_speed() const
 {
+  ++accesses[ CACHE_SPELL_SPEED ];
   if ( !active || !valid[ CACHE_SPELL_SPEED ] )
   {
+    ++misses[ CACHE_SPELL_SPEED ];
     valid[ CACHE_SPELL_SPEED ] = true;
     _spell_speed               = player->composite_spell_speed();
   }
@@ -11959,8 +12018,10 @@ double player_stat_cache_t::spell_speed() const
 
 double player_stat_cache_t::dodge() const
 {
+  ++accesses[ CACHE_DODGE ];
   if ( !active || !valid[ CACHE_DODGE ] )
   {
+    ++misses[ CACHE_DODGE ];
     valid[ CACHE_DODGE ] = true;
     _dodge               = player->composite_dodge();
   }
@@ -11971,8 +12032,10 @@ double player_stat_cache_t::dodge() const
 
 double player_stat_cache_t::parry() const
 {
+  ++accesses[ CACHE_PARRY ];
   if ( !active || !valid[ CACHE_PARRY ] )
   {
+    ++misses[ CACHE_PARRY ];
     valid[ CACHE_PARRY ] = true;
     _parry               = player->composite_parry();
   }
@@ -11983,8 +12046,10 @@ double player_stat_cache_t::parry() const
 
 double player_stat_cache_t::block() const
 {
+  ++accesses[ CACHE_BLOCK ];
   if ( !active || !valid[ CACHE_BLOCK ] )
   {
+    ++misses[ CACHE_BLOCK ];
     valid[ CACHE_BLOCK ] = true;
     _block               = player->composite_block();
   }
@@ -11995,8 +12060,10 @@ double player_stat_cache_t::block() const
 
 double player_stat_cache_t::crit_block() const
 {
+  ++accesses[ CACHE_CRIT_BLOCK ];
   if ( !active || !valid[ CACHE_CRIT_BLOCK ] )
   {
+    ++misses[ CACHE_CRIT_BLOCK ];
     valid[ CACHE_CRIT_BLOCK ] = true;
     _crit_block               = player->composite_crit_block();
   }
@@ -12007,8 +12074,10 @@ double player_stat_cache_t::crit_block() const
 
 double player_stat_cache_t::crit_avoidance() const
 {
+  ++accesses[ CACHE_CRIT_AVOIDANCE ];
   if ( !active || !valid[ CACHE_CRIT_AVOIDANCE ] )
   {
+    ++misses[ CACHE_CRIT_AVOIDANCE ];
     valid[ CACHE_CRIT_AVOIDANCE ] = true;
     _crit_avoidance               = player->composite_crit_avoidance();
   }
@@ -12019,8 +12088,10 @@ double player_stat_cache_t::crit_avoidance() const
 
 double player_stat_cache_t::miss() const
 {
+  ++accesses[ CACHE_MISS ];
   if ( !active || !valid[ CACHE_MISS ] )
   {
+    ++misses[ CACHE_MISS ];
     valid[ CACHE_MISS ] = true;
     _miss               = player->composite_miss();
   }
@@ -12031,8 +12102,10 @@ double player_stat_cache_t::miss() const
 
 double player_stat_cache_t::armor() const
 {
+  ++accesses[ CACHE_ARMOR ];
   if ( !active || !valid[ CACHE_ARMOR ] || !valid[ CACHE_BONUS_ARMOR ] )
   {
+    ++misses[ CACHE_ARMOR ];
     valid[ CACHE_ARMOR ] = true;
     _armor               = player->composite_armor();
   }
@@ -12043,8 +12116,10 @@ double player_stat_cache_t::armor() const
 
 double player_stat_cache_t::mastery() const
 {
+  ++accesses[ CACHE_MASTERY ];
   if ( !active || !valid[ CACHE_MASTERY ] )
   {
+    ++misses[ CACHE_MASTERY ];
     valid[ CACHE_MASTERY ] = true;
     _mastery               = player->composite_mastery();
     _mastery_value         = player->composite_mastery_value();
@@ -12061,8 +12136,10 @@ double player_stat_cache_t::mastery() const
  */
 double player_stat_cache_t::mastery_value() const
 {
+  ++accesses[ CACHE_MASTERY ];
   if ( !active || !valid[ CACHE_MASTERY ] )
   {
+    ++misses[ CACHE_MASTERY ];
     valid[ CACHE_MASTERY ] = true;
     _mastery               = player->composite_mastery();
     _mastery_value         = player->composite_mastery_value();
@@ -12074,8 +12151,10 @@ double player_stat_cache_t::mastery_value() const
 
 double player_stat_cache_t::bonus_armor() const
 {
+  ++accesses[ CACHE_BONUS_ARMOR ];
   if ( !active || !valid[ CACHE_BONUS_ARMOR ] )
   {
+    ++misses[ CACHE_BONUS_ARMOR ];
     valid[ CACHE_BONUS_ARMOR ] = true;
     _bonus_armor               = player->composite_bonus_armor();
   }
@@ -12086,8 +12165,10 @@ double player_stat_cache_t::bonus_armor() const
 
 double player_stat_cache_t::damage_versatility() const
 {
+  ++accesses[ CACHE_DAMAGE_VERSATILITY ];
   if ( !active || !valid[ CACHE_DAMAGE_VERSATILITY ] )
   {
+    ++misses[ CACHE_DAMAGE_VERSATILITY ];
     valid[ CACHE_DAMAGE_VERSATILITY ] = true;
     _damage_versatility               = player->composite_damage_versatility();
   }
@@ -12098,8 +12179,10 @@ double player_stat_cache_t::damage_versatility() const
 
 double player_stat_cache_t::heal_versatility() const
 {
+  ++accesses[ CACHE_HEAL_VERSATILITY ];
   if ( !active || !valid[ CACHE_HEAL_VERSATILITY ] )
   {
+    ++misses[ CACHE_HEAL_VERSATILITY ];
     valid[ CACHE_HEAL_VERSATILITY ] = true;
     _heal_versatility               = player->composite_heal_versatility();
   }
@@ -12110,8 +12193,10 @@ double player_stat_cache_t::heal_versatility() const
 
 double player_stat_cache_t::mitigation_versatility() const
 {
+  ++accesses[ CACHE_MITIGATION_VERSATILITY ];
   if ( !active || !valid[ CACHE_MITIGATION_VERSATILITY ] )
   {
+    ++misses[ CACHE_MITIGATION_VERSATILITY ];
     valid[ CACHE_MITIGATION_VERSATILITY ] = true;
     _mitigation_versatility               = player->composite_mitigation_versatility();
   }
@@ -12122,8 +12207,10 @@ double player_stat_cache_t::mitigation_versatility() const
 
 double player_stat_cache_t::leech() const
 {
+  ++accesses[ CACHE_LEECH ];
   if ( !active || !valid[ CACHE_LEECH ] )
   {
+    ++misses[ CACHE_LEECH ];
     valid[ CACHE_LEECH ] = true;
     _leech               = player->composite_leech();
   }
@@ -12134,8 +12221,10 @@ double player_stat_cache_t::leech() const
 
 double player_stat_cache_t::run_speed() const
 {
+  ++accesses[ CACHE_RUN_SPEED ];
   if ( !active || !valid[ CACHE_RUN_SPEED ] )
   {
+    ++misses[ CACHE_RUN_SPEED ];
     valid[ CACHE_RUN_SPEED ] = true;
     _run_speed               = player->composite_movement_speed();
   }
@@ -12146,8 +12235,10 @@ double player_stat_cache_t::run_speed() const
 
 double player_stat_cache_t::avoidance() const
 {
+  ++accesses[ CACHE_AVOIDANCE ];
   if ( !active || !valid[ CACHE_AVOIDANCE ] )
   {
+    ++misses[ CACHE_AVOIDANCE ];
     valid[ CACHE_AVOIDANCE ] = true;
     _avoidance               = player->composite_avoidance();
   }
@@ -12158,8 +12249,10 @@ double player_stat_cache_t::avoidance() const
 
 double player_stat_cache_t::player_multiplier( school_e s ) const
 {
+  ++accesses[ CACHE_PLAYER_DAMAGE_MULTIPLIER ];
   if ( !active || !player_mult_valid[ s ] )
   {
+    ++misses[ CACHE_PLAYER_DAMAGE_MULTIPLIER ];
     player_mult_valid[ s ] = true;
     _player_mult[ s ]      = player->composite_player_multiplier( s );
   }
@@ -12172,8 +12265,10 @@ double player_stat_cache_t::player_heal_multiplier( const action_state_t* s ) co
 {
   school_e sch = s->action->get_school();
 
+  ++accesses[ CACHE_PLAYER_HEAL_MULTIPLIER ];
   if ( !active || !player_heal_mult_valid[ sch ] )
   {
+    ++misses[ CACHE_PLAYER_HEAL_MULTIPLIER ];
     player_heal_mult_valid[ sch ] = true;
     _player_heal_mult[ sch ]      = player->composite_player_heal_multiplier( s );
   }
@@ -12339,6 +12434,30 @@ bool generic_container_type( const player_t* for_actor, int target_statistics_le
 
   return true;
 }
+
+// Calls fn for each sample data container of the collected data. Metric samples (and the fight
+// length, which is the timeline adjustor of single actor batch sims) are always kept at their
+// configured fidelity, auxiliary samples can be downgraded by the memory budget.
+template <typename Data, typename Fn>
+void for_each_sample( Data& d, bool auxiliary_only, Fn fn )
+{
+  if ( !auxiliary_only )
+  {
+    for ( auto s : { &d.fight_length, &d.prioritydps, &d.dps, &d.dtps, &d.hps, &d.htps, &d.aps, &d.atps,
+                     &d.theck_meloree_index, &d.target_metric } )
+    {
+      fn( *s );
+    }
+  }
+
+  for ( auto s : { &d.waiting_time, &d.pooling_time, &d.executed_foreground_actions, &d.dmg, &d.compound_dmg,
+                   &d.dpse, &d.dmg_taken, &d.heal, &d.compound_heal, &d.hpse, &d.heal_taken, &d.absorb,
+                   &d.compound_absorb, &d.absorb_taken, &d.deaths, &d.effective_theck_meloree_index,
+                   &d.max_spike_amount } )
+  {
+    fn( *s );
+  }
+}
 }  // namespace
 
 player_collected_data_t::player_collected_data_t( const player_t* player ) :
@@ -12424,6 +12543,72 @@ void player_collected_data_t::reserve_memory( const player_t& p )
   }
 }
 
+/// Number of sample containers collecting full data
+size_t player_collected_data_t::full_sample_count( bool metrics_only ) const
+{
+  size_t n = 0;
+  for_each_sample( *this, false, [ &n ]( const extended_sample_data_t& s ) { n += !s.simple; } );
+
+  if ( metrics_only )
+  {
+    for_each_sample( *this, true, [ &n ]( const extended_sample_data_t& s ) { n -= !s.simple; } );
+  }
+
+  return n;
+}
+
+/// Collect only sum/count/min/max for samples not reported as actor metrics
+void player_collected_data_t::simplify_auxiliary_samples()
+{
+  for_each_sample( *this, true, []( extended_sample_data_t& s ) {
+    if ( !s.simple )
+    {
+      s.change_mode( true );
+    }
+  } );
+}
+
+actor_memory_usage_t player_t::memory_usage() const
+{
+  actor_memory_usage_t usage;
+
+  const auto& d = collected_data;
+  usage.collected_data = sizeof( d );
+  for_each_sample( d, false, [ &usage ]( const extended_sample_data_t& s ) {
+    usage.collected_data += s.memory_usage();
+  } );
+  usage.collected_data += ( d.action_sequence.capacity() + d.action_sequence_precombat.capacity() ) *
+                          sizeof( player_collected_data_t::action_sequence_data_t );
+
+  usage.timelines = d.timeline_dmg.memory_usage() + d.timeline_dmg_taken.memory_usage() +
+                    d.timeline_healing_taken.memory_usage();
+  for ( const auto& rt : d.resource_timelines )
+    usage.timelines += rt.timeline.memory_usage();
+  for ( const auto& st : d.stat_timelines )
+    usage.timelines += st.timeline.memory_usage();
+  for ( const auto hc : { &d.health_changes, &d.health_changes_tmi } )
+  {
+    usage.timelines += hc->timeline.memory_usage() + hc->timeline_normalized.memory_usage() +
+                       hc->merged_timeline.memory_usage();
+  }
+
+  for ( const stats_t* s : stats_list )
+  {
+    usage.stats += sizeof( *s ) + s->actual_amount.memory_usage() + s->total_amount.memory_usage() +
+                   s->portion_aps.memory_usage() + s->portion_apse.memory_usage();
+    if ( s->timeline_amount )
+      usage.timelines += s->timeline_amount->memory_usage();
+  }
+
+  for ( const buff_t* b : buff_list )
+  {
+    usage.buffs += sizeof( *b ) + b->stack_uptime.capacity() * sizeof( uptime_simple_t );
+    usage.timelines += b->uptime_array.memory_usage();
+  }
+
+  return usage;
+}
+
 void player_collected_data_t::merge( const player_t& other_player )
 {
   const auto& other = other_player.collected_data;
@@ -12576,28 +12761,19 @@ void player_collected_data_t::print_tmi_debug_csv( const sc_timeline_t* nma, con
   }
 }
 
-double player_collected_data_t::calculate_max_spike_damage( const health_changes_timeline_t& tl, int window )
+// Both the max spike and TMI work on the sliding average of the normalized health change
+// timeline, which collect_data() builds once per timeline and window.
+double player_collected_data_t::calculate_max_spike_damage( const sc_timeline_t& sliding_average, int window )
 {
-  double max_spike = 0;
-
-  // declare sliding average timeline
-  sc_timeline_t sliding_average_tl;
-
-  // create sliding average timelines from data
-  tl.timeline_normalized.build_sliding_average_timeline( sliding_average_tl, window );
-
-  // pull the data out of the normalized sliding average timeline
-  std::vector<double> weighted_value = sliding_average_tl.data();
-
   // extract the max spike size from the sliding average timeline
-  max_spike = *std::max_element( weighted_value.begin(), weighted_value.end() );  // todo: remove weighted_value here
+  double max_spike = sliding_average.max();
   max_spike *= window;
 
   return max_spike;
 }
 
-double player_collected_data_t::calculate_tmi( const health_changes_timeline_t& tl, int window, double f_length,
-                                               const player_t& p )
+double player_collected_data_t::calculate_tmi( const sc_timeline_t& sliding_average, int window, double bin_size,
+                                               double f_length, const player_t& p )
 {
   // The Theck-Meloree Index is a metric that attempts to quantize the smoothness of damage intake.
   // It performs an exponentially-weighted sum of the moving average of damage intake, with larger
@@ -12607,39 +12783,27 @@ double player_collected_data_t::calculate_tmi( const health_changes_timeline_t&
   // accumulator
   double tmi = 0;
 
-  // declare sliding average timeline
-  sc_timeline_t sliding_average_tl;
-
-  // create sliding average timelines from data
-  tl.timeline_normalized.build_sliding_average_timeline( sliding_average_tl, window );
-
-  // pull the data out of the normalized sliding average timeline
-  std::vector<double> weighted_value = sliding_average_tl.data();
-
   // define constants
   double D  = 10;          // filtering strength
   double c2 = 450;         // N_0, default fight length for normalization
   double c1 = 100000 / D;  // health scale factor, determines slope of plot
 
-  for ( auto& elem : weighted_value )
+  for ( double value : sliding_average.data() )
   {
-    // weighted_value is the moving average (i.e. 1-second), so multiply by window size to get damage in "window"
+    // the sliding average is the moving average (i.e. 1-second), so multiply by window size to get damage in "window"
     // seconds
-    elem *= window;
-
-    // calculate exponentially-weighted contribution of this data point using filter strength D
-    elem = std::exp( D * elem );
+    value *= window;
 
-    // add to the TMI total; strictly speaking this should be moved outside the for loop and turned into a sort()
-    // followed by a sum for numerical accuracy
-    tmi += elem;
+    // add the exponentially-weighted contribution of this data point using filter strength D to the TMI total;
+    // strictly speaking this should be turned into a sort() followed by a sum for numerical accuracy
+    tmi += std::exp( D * value );
   }
 
   // multiply by vertical offset factor c2
   tmi *= c2;
   // normalize for fight length - should be equivalent to dividing by tl.timeline_normalized.data().size()
   tmi /= f_length;
-  tmi *= tl.get_bin_size();
+  tmi *= bin_size;
   // take log of result
   tmi = std::log( tmi );
   // multiply by health decade scale factor
@@ -12647,7 +12811,15 @@ double player_collected_data_t::calculate_tmi( const health_changes_timeline_t&
 
   // if an output file has been defined, write to it
   if ( !p.tmi_debug_file_str.empty() )
-    print_tmi_debug_csv( &sliding_average_tl, weighted_value, p );
+  {
+    std::vector<double> weighted_value = sliding_average.data();
+    for ( auto& elem : weighted_value )
+    {
+      elem *= window;
+      elem = std::exp( D * elem );
+    }
+    print_tmi_debug_csv( &sliding_average, weighted_value, p );
+  }
 
   return tmi;
 }
@@ -12747,14 +12919,19 @@ void player_collected_data_t::collect_data( const player_t& p )
         int window = (int)std::floor( p.tmi_window / health_changes_tmi.get_bin_size() +
                                       0.5 );  // window size, bin time replaces 1 eventually
 
+        // create sliding average timelines from data
+        sc_timeline_t sliding_average_tmi, sliding_average;
+        health_changes_tmi.timeline_normalized.build_sliding_average_timeline( sliding_average_tmi, window );
+        health_changes.timeline_normalized.build_sliding_average_timeline( sliding_average, window );
+
         // Standard TMI uses health_changes_tmi, ignoring externals - use health_changes_tmi
-        tmi = calculate_tmi( health_changes_tmi, window, f_length, p );
+        tmi = calculate_tmi( sliding_average_tmi, window, health_changes_tmi.get_bin_size(), f_length, p );
 
         // ETMI includes external healing - use health_changes
-        etmi = calculate_tmi( health_changes, window, f_length, p );
+        etmi = calculate_tmi( sliding_average, window, health_changes.get_bin_size(), f_length, p );
 
         // Max spike uses health_changes_tmi as well, ignores external heals - use health_changes_tmi
-        max_spike = calculate_max_spike_damage( health_changes_tmi, window );
+        max_spike = calculate_max_spike_damage( sliding_average_tmi, window );
 
         tank_metric = tmi;
       }
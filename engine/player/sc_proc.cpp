@@ -1285,6 +1285,20 @@ void dbc_proc_callback_t::initialize()
   listener -> callbacks.register_callback( effect.proc_flags(), effect.proc_flags2(), this );
 }
 
+/**
+ * The stock trigger() returns immediately while the proc cooldown is down. Derived callbacks may
+ * override trigger() with their own logic, so only expose the cooldown for the base type.
+ */
+const cooldown_t* dbc_proc_callback_t::trigger_cooldown() const
+{
+  if ( typeid( *this ) != typeid( dbc_proc_callback_t ) )
+  {
+    return nullptr;
+  }
+
+  return cooldown;
+}
+
 /**
  * Cooldown name needs some special handling. Cooldowns in WoW are global, regardless of the
  * number of procs (i.e., weapon enchants). Thus, we straight up use the driver's name, or
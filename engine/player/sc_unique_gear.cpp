@@ -5073,6 +5073,88 @@ void unique_gear::sort_special_effects()
   range::sort( __fallback_effect_db, cmp_special_effect );
 }
 
+namespace
+{
+// Lazy registration state of the special effect database. The generic (item, enchant, azerite,
+// racial) effects are registered when the first actor is created, class module effects when the
+// first actor of that class is created. Registration mutates the global databases, so it must
+// complete before any simulator thread reads them. Multi-threaded sims and profileset runs
+// register everything on the main thread before starting other threads.
+struct special_effect_registry_t
+{
+  mutex_t mutex;
+  bool generic;
+  std::array<bool, PLAYER_MAX> modules;
+
+  special_effect_registry_t() : generic( false )
+  { modules.fill( false ); }
+};
+
+special_effect_registry_t& special_effect_registry()
+{
+  static special_effect_registry_t registry;
+  return registry;
+}
+
+// Register the generic special effects and the class module effects of [first, last), returning
+// the wall time spent doing so, in seconds
+double init_special_effects_range( player_e first, player_e last )
+{
+  auto& registry = special_effect_registry();
+  AUTO_LOCK( registry.mutex );
+
+  auto start = std::chrono::high_resolution_clock::now();
+  auto db_size = __special_effect_db.size();
+  auto fallback_db_size = __fallback_effect_db.size();
+
+  if ( ! registry.generic )
+  {
+    unique_gear::register_special_effects();
+    registry.generic = true;
+  }
+
+  for ( player_e type = first; type < last; type++ )
+  {
+    if ( type <= PLAYER_NONE || registry.modules[ type ] )
+    {
+      continue;
+    }
+
+    registry.modules[ type ] = true;
+    if ( const module_t* module = module_t::get( type ) )
+    {
+      module -> static_init();
+    }
+  }
+
+  // Modules without special effects (e.g., enemies) leave the databases untouched, do not re-sort
+  // them in that case
+  if ( __special_effect_db.size() == db_size && __fallback_effect_db.size() == fallback_db_size )
+  {
+    return 0;
+  }
+
+  unique_gear::sort_special_effects();
+
+  return util::duration_fp_seconds( start );
+}
+} // unnamed namespace ends
+
+double unique_gear::init_special_effects( player_e type )
+{
+  if ( type <= PLAYER_NONE || type >= PLAYER_MAX )
+  {
+    return init_special_effects_range( PLAYER_NONE, PLAYER_NONE );
+  }
+
+  return init_special_effects_range( type, static_cast<player_e>( type + 1 ) );
+}
+
+double unique_gear::init_all_special_effects()
+{
+  return init_special_effects_range( PLAYER_NONE, PLAYER_MAX );
+}
+
 // Apply all label-based modifiers to an action, if the associated spell data for the application ha
 // any labels. Used by proc_action_t-derived spells (currently item special effects) to
 // automatically apply various class passives (e.g., Shaman, Enhancement Shaman, ...) to those
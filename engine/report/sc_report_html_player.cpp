@@ -2272,7 +2272,7 @@ void print_html_player_action_priority_list( report::sc_html_stream& os, const p
   {
     const action_t* a = p.action_list[ i ];
 
-    if ( a->signature_str.empty() || !( a->marker || a->action_list ) )
+    if ( a->signature_str->empty() || !( a->marker || a->action_list ) )
       continue;
 
     if ( !alist || a->action_list->name_str != alist->name_str )
@@ -2316,10 +2316,10 @@ void print_html_player_action_priority_list( report::sc_html_stream& os, const p
       continue;
 
     os << "<tr>\n";
-    std::string as = util::encode_html( a->signature->action_.c_str() );
-    if ( !a->signature->comment_.empty() )
+    std::string as = util::encode_html( *a->signature->action_ );
+    if ( !a->signature->comment_->empty() )
       as += "<br/><small><em>" +
-            util::encode_html( a->signature->comment_.c_str() ) +
+            util::encode_html( *a->signature->comment_ ) +
             "</em></small>";
 
     os.printf(
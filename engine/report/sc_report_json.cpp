@@ -12,6 +12,7 @@
 #include "util/rapidjson/document.h"
 #include "util/rapidjson/stringbuffer.h"
 #include "util/rapidjson/prettywriter.h"
+#include "util/rapidjson/writer.h"
 
 using namespace rapidjson;
 using namespace js;
@@ -900,7 +901,8 @@ void iteration_data_to_json( JsonOutput root, const std::vector<iteration_data_e
   } );
 }
 
-void to_json( JsonOutput root, const sim_t& sim )
+// Sim-scope options and overrides
+void sim_options_to_json( JsonOutput root, const sim_t& sim )
 {
   // Sim-scope options
   auto options_root = root[ "options" ];
@@ -989,14 +991,11 @@ void to_json( JsonOutput root, const sim_t& sim )
   {
     overrides[ "target_health" ] = sim.overrides.target_health;
   }
+}
 
-  // Players
-  JsonOutput players_arr = root[ "players" ].make_array();
-
-  range::for_each( sim.player_no_pet_list.data(), [ &players_arr ]( const player_t* p ) {
-    to_json( players_arr, *p );
-  } );
-
+// Profileset results and sim statistics, written after the players
+void sim_statistics_to_json( JsonOutput root, const sim_t& sim )
+{
   if ( sim.profilesets.n_profilesets() > 0 )
   {
     auto profileset_root = root[ "profilesets" ];
@@ -1006,6 +1005,7 @@ void to_json( JsonOutput root, const sim_t& sim )
   auto stats_root = root[ "statistics" ];
   stats_root[ "elapsed_cpu_seconds" ] = sim.elapsed_cpu;
   stats_root[ "elapsed_time_seconds" ] = sim.elapsed_time;
+  stats_root[ "startup_time_seconds" ] = sim.startup_time;
   stats_root[ "init_time_seconds" ] = sim.init_time;
   stats_root[ "merge_time_seconds" ] = sim.merge_time;
   stats_root[ "analyze_time_seconds" ] = sim.analyze_time;
@@ -1017,86 +1017,176 @@ void to_json( JsonOutput root, const sim_t& sim )
   add_non_zero( stats_root, "total_dmg", sim.total_dmg );
   add_non_zero( stats_root, "total_heal", sim.total_heal );
   add_non_zero( stats_root, "total_absorb", sim.total_absorb );
+}
 
-  if ( sim.report_details != 0 )
+// Detailed sim data written after the targets, if report_details is enabled
+void sim_details_to_json( JsonOutput root, const sim_t& sim )
+{
+  // Raid events
+  if ( ! sim.raid_events.empty() )
   {
-    // Targets
-    JsonOutput targets_arr = root[ "targets" ].make_array();
+    auto arr = root[ "raid_events" ].make_array();
 
-    range::for_each( sim.target_list.data(), [ &targets_arr ]( const player_t* p ) {
-      to_json( targets_arr, *p );
+    range::for_each( sim.raid_events, [ &arr ]( const std::unique_ptr<raid_event_t>& event ) {
+      to_json( arr, *event );
     } );
+  }
 
-    // Raid events
-    if ( ! sim.raid_events.empty() )
-    {
-      auto arr = root[ "raid_events" ].make_array();
+  if ( sim.buff_list.size() > 0 )
+  {
+    JsonOutput buffs_arr = root[ "sim_auras" ].make_array();
+    range::for_each( sim.buff_list, [ &buffs_arr ]( const buff_t* b ) {
+      if ( b -> avg_start.mean() == 0 )
+      {
+        return;
+      }
+      to_json( buffs_arr.add(), b );
+    } );
+  }
 
-      range::for_each( sim.raid_events, [ &arr ]( const std::unique_ptr<raid_event_t>& event ) {
-        to_json( arr, *event );
-      } );
-    }
+  if ( sim.low_iteration_data.size() > 0 )
+  {
+    iteration_data_to_json( root[ "iteration_data" ][ "low" ], sim.low_iteration_data );
+  }
 
-    if ( sim.buff_list.size() > 0 )
-    {
-      JsonOutput buffs_arr = root[ "sim_auras" ].make_array();
-      range::for_each( sim.buff_list, [ &buffs_arr ]( const buff_t* b ) {
-        if ( b -> avg_start.mean() == 0 )
-        {
-          return;
-        }
-        to_json( buffs_arr.add(), b );
-      } );
-    }
+  if ( sim.high_iteration_data.size() > 0 )
+  {
+    iteration_data_to_json( root[ "iteration_data" ][ "high" ], sim.high_iteration_data );
+  }
+}
+
+/**
+ * The report is streamed to the writer section by section.
+ *
+ * Each section (the sim options, each player, each target, ...) is built into its own small
+ * document with the JsonOutput helpers and written out right away, so only the section being
+ * written is held in memory. The output schema is identical to building the full document.
+ */
+
+// Write all members generated by fn into the currently open object of the writer
+template <typename JsonWriter, typename Fn>
+void write_members( JsonWriter& writer, Fn&& fn )
+{
+  Document doc;
+  doc.SetObject();
+
+  fn( JsonOutput( doc, doc ) );
 
-    if ( sim.low_iteration_data.size() > 0 )
+  for ( auto it = doc.MemberBegin(); it != doc.MemberEnd(); ++it )
+  {
+    writer.Key( it -> name.GetString(), it -> name.GetStringLength() );
+    if ( ! it -> value.Accept( writer ) )
     {
-      iteration_data_to_json( root[ "iteration_data" ][ "low" ], sim.low_iteration_data );
+      throw std::runtime_error("JSON Writer did not accept document.");
     }
+  }
+}
 
-    if ( sim.high_iteration_data.size() > 0 )
+// Write all array elements generated by fn into the currently open array of the writer
+template <typename JsonWriter, typename Fn>
+void write_elements( JsonWriter& writer, Fn&& fn )
+{
+  Document doc;
+  doc.SetArray();
+
+  JsonOutput arr( doc, doc );
+  fn( arr );
+
+  for ( auto it = doc.Begin(); it != doc.End(); ++it )
+  {
+    if ( ! it -> Accept( writer ) )
     {
-      iteration_data_to_json( root[ "iteration_data" ][ "high" ], sim.high_iteration_data );
+      throw std::runtime_error("JSON Writer did not accept document.");
     }
   }
 }
 
-void print_json_pretty( FILE* o, const sim_t& sim )
+template <typename JsonWriter>
+void sim_to_json( JsonWriter& writer, const sim_t& sim )
 {
-  Document doc;
-  Value& v = doc;
-  v.SetObject();
+  writer.StartObject();
 
-  JsonOutput root( doc, v );
+  write_members( writer, [ &sim ]( JsonOutput root ) { sim_options_to_json( root, sim ); } );
 
-  root[ "version" ] = SC_VERSION;
-  root[ "ptr_enabled" ] = SC_USE_PTR;
-  root[ "beta_enabled" ] = SC_BETA;
-  root[ "build_date" ] = __DATE__;
-  root[ "build_time" ] = __TIME__;
-  root[ "timestamp" ] = as<uint64_t>( std::time( nullptr ) );
+  writer.Key( "players" );
+  writer.StartArray();
+  range::for_each( sim.player_no_pet_list.data(), [ &writer ]( const player_t* p ) {
+    write_elements( writer, [ p ]( JsonOutput arr ) { to_json( arr, *p ); } );
+  } );
+  writer.EndArray();
+
+  write_members( writer, [ &sim ]( JsonOutput root ) { sim_statistics_to_json( root, sim ); } );
 
-  if ( git_info::available())
+  if ( sim.report_details != 0 )
   {
-    root[ "git_revision" ] = git_info::revision();
-    root[ "git_branch" ] = git_info::branch();
+    writer.Key( "targets" );
+    writer.StartArray();
+    range::for_each( sim.target_list.data(), [ &writer ]( const player_t* p ) {
+      write_elements( writer, [ p ]( JsonOutput arr ) { to_json( arr, *p ); } );
+    } );
+    writer.EndArray();
+
+    write_members( writer, [ &sim ]( JsonOutput root ) { sim_details_to_json( root, sim ); } );
   }
 
-  to_json( root[ "sim" ], sim );
+  writer.EndObject();
+}
+
+template <typename JsonWriter>
+void print_json_stream( JsonWriter& writer, const sim_t& sim )
+{
+  writer.StartObject();
+
+  write_members( writer, []( JsonOutput root ) {
+    root[ "version" ] = SC_VERSION;
+    root[ "ptr_enabled" ] = SC_USE_PTR;
+    root[ "beta_enabled" ] = SC_BETA;
+    root[ "build_date" ] = __DATE__;
+    root[ "build_time" ] = __TIME__;
+    root[ "timestamp" ] = as<uint64_t>( std::time( nullptr ) );
+
+    if ( git_info::available())
+    {
+      root[ "git_revision" ] = git_info::revision();
+      root[ "git_branch" ] = git_info::branch();
+    }
+  } );
+
+  writer.Key( "sim" );
+  sim_to_json( writer, sim );
 
   if ( sim.error_list.size() > 0 )
   {
-    root[ "notifications" ] = sim.error_list;
+    write_members( writer, [ &sim ]( JsonOutput root ) {
+      root[ "notifications" ] = sim.error_list;
+    } );
   }
 
+  writer.EndObject();
+
+  if ( ! writer.IsComplete() )
+  {
+    throw std::runtime_error("JSON Writer did not complete document.");
+  }
+}
+
+void print_json_report( FILE* o, const sim_t& sim )
+{
   std::array<char, 16384> buffer;
   FileWriteStream b( o, buffer.data(), buffer.size() );
-  PrettyWriter<FileWriteStream> writer( b );
-  auto accepted = doc.Accept( writer );
-  if ( !accepted )
+
+  if ( sim.json_compact )
+  {
+    Writer<FileWriteStream> writer( b );
+    print_json_stream( writer, sim );
+  }
+  else
   {
-    throw std::runtime_error("JSON Writer did not accept document.");
+    PrettyWriter<FileWriteStream> writer( b );
+    print_json_stream( writer, sim );
   }
+
+  b.Flush();
 }
 
 }  // unnamed namespace
@@ -1128,7 +1218,7 @@ void print_json( sim_t& sim )
       {
         t.start();
       }
-      print_json_pretty( s, sim );
+      print_json_report( s, sim );
     }
     catch ( const std::exception& e )
     {
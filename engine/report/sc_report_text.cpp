@@ -125,15 +125,15 @@ void print_player_actions( std::ostream& os, const player_t& p )
       constexpr size_t max_length = 140;
       for ( auto& ap : alist->action_list )
       {
-        if ( length > max_length || ( length > 0 && ( length + ap.action_.size() ) > max_length ) )
+        if ( length > max_length || ( length > 0 && ( length + ap.action_->size() ) > max_length ) )
         {
           fmt::print( os, "\n" );
           length = 0;
         }
         fmt::print( os, "{}{}",
             ( ( length > 0 ) ? "/" : "    " ),
-            ap.action_ );
-        length += ap.action_.size();
+            *ap.action_ );
+        length += ap.action_->size();
       }
       fmt::print( os, "\n" );
     }
@@ -577,6 +577,37 @@ void print_uptimes_benefits( std::ostream& os, const player_t& p )
   }
 }
 
+void print_stat_cache( std::ostream& os, const player_t& p )
+{
+  if ( !p.cache.active )
+  {
+    return;
+  }
+
+  bool first = true;
+
+  for ( cache_e c = CACHE_NONE; c < CACHE_MAX; ++c )
+  {
+    if ( p.cache.accesses[ c ] == 0 && p.cache.generation[ c ] == 0 )
+    {
+      continue;
+    }
+
+    if ( first )
+    {
+      fmt::print( os, "  Stat Cache:\n" );
+      first = false;
+    }
+
+    fmt::print( os, "    {:<28} : accesses={} misses={} ({:.2f}%) invalidations={}\n",
+        util::cache_type_string( c ),
+        p.cache.accesses[ c ],
+        p.cache.misses[ c ],
+        p.cache.accesses[ c ] ? 100.0 * p.cache.misses[ c ] / p.cache.accesses[ c ] : 0.0,
+        p.cache.generation[ c ] );
+  }
+}
+
 void print_waiting_player( std::ostream& os, const player_t& p )
 {
   double wait_time = 0;
@@ -749,6 +780,33 @@ void print_iteration_data( std::ostream& os, const sim_t& sim )
   }
 }
 
+void print_memory_usage( std::ostream& os, const player_t& p )
+{
+  auto usage = p.memory_usage();
+
+  fmt::print( os, "  Memory Usage: total={:.1f}KB collected_data={:.1f}KB stats={:.1f}KB buffs={:.1f}KB timelines={:.1f}KB\n",
+      usage.total() / 1024.0,
+      usage.collected_data / 1024.0,
+      usage.stats / 1024.0,
+      usage.buffs / 1024.0,
+      usage.timelines / 1024.0 );
+}
+
+void sim_summary_memory( std::ostream& os, const sim_t& sim )
+{
+  fmt::print( os, "\nMemory Usage:\n" );
+  fmt::print( os, "  Events        = {:.1f}KB\n", sim.event_mgr.memory_usage() / 1024.0 );
+  fmt::print( os, "  Sim           = {:.1f}MB\n", sim.memory_usage() / ( 1024.0 * 1024.0 ) );
+  for ( const auto& child : sim.child_memory_usage )
+  {
+    fmt::print( os, "  Thread-{:<7} = {:.1f}MB\n", child.first, child.second / ( 1024.0 * 1024.0 ) );
+  }
+  if ( sim.memory_budget > 0 )
+  {
+    fmt::print( os, "  Budget        = {:.1f}MB (fidelity level {})\n", sim.memory_budget, sim.memory_budget_level );
+  }
+}
+
 void sim_summary_performance( std::ostream& os, sim_t* sim )
 {
   std::time_t cur_time = std::time( nullptr );
@@ -787,6 +845,7 @@ void sim_summary_performance( std::ostream& os, sim_t* sim )
       "  SimSeconds    = {}\n"
       "  CpuSeconds    = {}\n"
       "  WallSeconds   = {}\n"
+      "  StartupSeconds= {}\n"
       "  InitSeconds   = {}\n"
       "  MergeSeconds  = {}\n"
       "  AnalyzeSeconds= {}\n"
@@ -808,6 +867,7 @@ void sim_summary_performance( std::ostream& os, sim_t* sim )
       sim->target->resources.base[ RESOURCE_HEALTH ],
       sim->simulation_length.sum(), sim->elapsed_cpu,
       sim->elapsed_time,
+      sim->startup_time,
       sim->init_time,
       sim->merge_time,
       sim->analyze_time,
@@ -1191,6 +1251,10 @@ void print_player( std::ostream& os, player_t& p )
   print_uptimes_benefits( os, p );
   print_procs( os, p );
   print_player_gains( os, p );
+  if ( p.sim->report_stat_cache )
+    print_stat_cache( os, p );
+  if ( p.sim->report_memory )
+    print_memory_usage( os, p );
   print_player_scale_factors( os, p, p.report_information );
   print_dps_plots( os, p );
   print_waiting_player( os, p );
@@ -1295,6 +1359,9 @@ void print_text_report( std::ostream& os, sim_t* sim, bool detail )
 
   sim_summary_performance( os, sim );
 
+  if ( sim->report_memory )
+    sim_summary_memory( os, *sim );
+
   if ( detail )
   {
     print_waiting_all( os, *sim );
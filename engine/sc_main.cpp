@@ -218,14 +218,9 @@ struct apitoken_initializer_t
 };
 #endif
 
+// Special effects are registered lazily on actor creation, only the cleanup is scoped here
 struct special_effect_initializer_t
 {
-  special_effect_initializer_t()
-  {
-    unique_gear::register_special_effects();
-    unique_gear::sort_special_effects();
-  }
-
   ~special_effect_initializer_t()
   { unique_gear::unregister_special_effects(); }
 };
@@ -251,6 +246,8 @@ int sim_t::main( const std::vector<std::string>& args )
 {
   try
   {
+    auto start = std::chrono::high_resolution_clock::now();
+
     cache_initializer_t cache_init( get_cache_directory() + "/simc_cache.dat" );
 #if !defined( SC_NO_NETWORKING )
     apitoken_initializer_t apitoken_init;
@@ -278,6 +275,8 @@ int sim_t::main( const std::vector<std::string>& args )
     // begins
     hotfix::apply();
 
+    startup_time = util::duration_fp_seconds( start );
+
     try
     {
       setup( &control );
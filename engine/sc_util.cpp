@@ -11,6 +11,7 @@
 
 
 #include <cerrno>
+#include <unordered_set>
 
 namespace { // anonymous namespace ==========================================
 
@@ -3090,6 +3091,77 @@ bool util::contains_non_ascii( const std::string& s )
   return false;
 }
 
+namespace
+{
+struct shared_text_hash_t
+{
+  size_t operator()( const util::shared_text_t& text ) const
+  { return std::hash<std::string>()( *text ); }
+};
+
+struct shared_text_equal_t
+{
+  bool operator()( const util::shared_text_t& l, const util::shared_text_t& r ) const
+  { return *l == *r; }
+};
+
+struct shared_text_pool_t
+{
+  mutex_t mutex;
+  std::unordered_set<util::shared_text_t, shared_text_hash_t, shared_text_equal_t> text;
+  size_t purge_size = 1024;
+
+  // Drop text no longer referenced by any sim, amortized against pool growth
+  void purge()
+  {
+    for ( auto it = text.begin(); it != text.end(); )
+    {
+      if ( it -> use_count() == 1 )
+        it = text.erase( it );
+      else
+        ++it;
+    }
+
+    purge_size = std::max( size_t( 1024 ), text.size() * 2 );
+  }
+};
+} // unnamed namespace
+
+/**
+ * Intern text into the process-wide shared text pool.
+ *
+ * Returns the pooled copy of the text, allocating it on first use. The pool itself only holds
+ * the text while some sim references it.
+ */
+util::shared_text_t util::share_text( const std::string& text )
+{
+  static const shared_text_t empty = std::make_shared<const std::string>();
+  static shared_text_pool_t pool;
+
+  if ( text.empty() )
+  {
+    return empty;
+  }
+
+  // Non-owning probe, so lookups of already pooled text do not allocate
+  const shared_text_t probe( shared_text_t(), &text );
+
+  AUTO_LOCK( pool.mutex );
+
+  auto it = pool.text.find( probe );
+  if ( it != pool.text.end() )
+  {
+    return *it;
+  }
+
+  if ( pool.text.size() >= pool.purge_size )
+  {
+    pool.purge();
+  }
+
+  return *pool.text.insert( std::make_shared<const std::string>( text ) ).first;
+}
+
 /**
  * Print chained exceptions, separated by ' :'.
  */
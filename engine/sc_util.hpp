@@ -19,6 +19,7 @@
 #include <string>
 #include <cstdarg>
 #include <chrono>
+#include <memory>
 
 // Forward declarations
 struct player_t;
@@ -204,6 +205,12 @@ int numDigits( T number );
 
 bool contains_non_ascii( const std::string& );
 
+// Immutable, reference counted text interned for the whole process. Parent, child and profileset
+// sims parsing the same actor profiles resolve identical text (APL lines, comments) to a single
+// allocation instead of holding a copy each.
+using shared_text_t = std::shared_ptr<const std::string>;
+shared_text_t share_text( const std::string& text );
+
 template <class T>
 double duration_fp_seconds(const T& chrono_time)
 {
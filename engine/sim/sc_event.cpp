@@ -5,6 +5,16 @@
 
 #include "simulationcraft.hpp"
 
+namespace
+{
+// All events are allocated in fixed size blocks, so they can be recycled regardless of type
+std::size_t event_block_size()
+{
+  static const std::size_t SIZE = util::next_power_of_two( 2 * sizeof( event_t ) );
+  return SIZE;
+}
+}  // namespace
+
 // ==========================================================================
 // Event
 // ==========================================================================
@@ -136,7 +146,7 @@ event_manager_t::~event_manager_t()
 
 void* event_manager_t::allocate_event( const std::size_t size )
 {
-  static const std::size_t SIZE = util::next_power_of_two( 2 * sizeof( event_t ) );
+  const std::size_t SIZE = event_block_size();
   assert( SIZE > size );
   (void)size;
 
@@ -486,3 +496,11 @@ void event_manager_t::merge( event_manager_t& other )
 
 #endif
 }
+
+// event_manager_t::memory_usage ============================================
+
+size_t event_manager_t::memory_usage() const
+{
+  return allocated_events.size() * event_block_size() +
+         ( allocated_events.capacity() + timing_wheel.capacity() ) * sizeof( event_t* );
+}
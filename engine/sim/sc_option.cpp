@@ -5,6 +5,8 @@
 
 #include "sc_option.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <sstream>
 #include <iostream>
 
@@ -68,47 +70,104 @@ std::string base_name( const std::string& file_path )
   return base_name;
 }
 
-void do_replace( const option_db_t& opts, std::string& str, std::string::size_type begin, int depth )
+/**
+ * Expand template variables "$(name)" in str in a single pass.
+ *
+ * Nested references are expanded innermost first, i.e. "$(a_$(b))" looks up the variable named
+ * "a_" followed by the value of b. Expanded values are not scanned again.
+ */
+void expand_variables( const option_db_t& opts, std::string& str )
 {
-  static const int max_depth = 10;
-  if ( depth > max_depth )
-  {
-    std::stringstream s;
-    s << "Nesting depth exceeded for: '" << str << "' (max: " << max_depth << ")";
-    throw std::invalid_argument( s.str() );
-  }
+  static const size_t max_depth = 10;
 
+  auto begin = str.find( "$(" );
   if ( begin == std::string::npos )
   {
     return;
   }
 
-  auto next = str.find( "$(", begin + 2 );
-  if ( next != std::string::npos )
+  std::string out( str, 0, begin );
+  std::vector<std::string::size_type> open; // Positions of unclosed "$(" in out
+
+  for ( auto i = begin; i < str.size(); ++i )
   {
-    do_replace( opts, str, next, ++depth );
+    if ( str[ i ] == '$' && i + 1 < str.size() && str[ i + 1 ] == '(' )
+    {
+      if ( open.size() >= max_depth )
+      {
+        throw std::invalid_argument( fmt::format( "Nesting depth exceeded for: '{}' (max: {})", str, max_depth ) );
+      }
+
+      open.push_back( out.size() );
+      out += "$(";
+      ++i;
+    }
+    else if ( str[ i ] == ')' && ! open.empty() )
+    {
+      auto start = open.back();
+      open.pop_back();
+
+      auto it = opts.var_map.find( out.substr( start + 2 ) );
+      if ( it == opts.var_map.end() )
+      {
+        throw std::invalid_argument( fmt::format( "Missing template variable: '{}'", out.substr( start + 2 ) ) );
+      }
+
+      out.resize( start );
+      out += it -> second;
+    }
+    else
+    {
+      out += str[ i ];
+    }
   }
 
-  auto end = str.find( ")", begin + 2 );
-  if ( end == std::string::npos )
+  if ( ! open.empty() )
   {
-    std::stringstream s;
-    s << "Unbalanced parenthesis in template variable for: '" << str << "'";
-    throw std::invalid_argument( s.str() );
+    throw std::invalid_argument( fmt::format( "Unbalanced parenthesis in template variable for: '{}'", str ) );
   }
 
-  auto var = str.substr( begin + 2, ( end - begin ) - 2 );
-  if ( opts.var_map.find( var ) == opts.var_map.end() )
+  str.swap( out );
+}
+
+/**
+ * Split [first, last) into whitespace separated tokens, calling fn for each one.
+ *
+ * Double quotes group whitespace into a token and are removed. Empty tokens are skipped. The
+ * token buffer is reused, so only tokens that outgrow it allocate.
+ */
+template <typename Fn>
+void split_tokens( const char* first, const char* last, Fn fn )
+{
+  std::string token;
+  bool in_quote = false;
+
+  for ( ; first != last; ++first )
   {
-    std::stringstream s;
-    s << "Missing template variable: '" << var << "'";
-    throw std::invalid_argument( s.str() );
+    if ( *first == '"' )
+    {
+      in_quote = ! in_quote;
+    }
+    else if ( ! in_quote && is_white_space( *first ) )
+    {
+      if ( ! token.empty() )
+      {
+        fn( token );
+        token.clear();
+      }
+    }
+    else
+    {
+      token += *first;
+    }
   }
 
-  str.replace( begin, end - begin + 1, opts.var_map.at( var ) );
+  if ( ! token.empty() )
+  {
+    fn( token );
+  }
 }
 
-
 // Shared data base path
 #ifndef SC_SHARED_DATA
   #if defined( SC_LINUX_PACKAGING )
@@ -398,6 +457,10 @@ struct opts_map_t : public option_t
     option_t( name ),
     _ref( ref )
   { }
+
+  bool prefix_match() const override
+  { return true; }
+
 protected:
   opts::parse_status parse( sim_t*, const std::string& n, const std::string& v ) const override
   {
@@ -443,6 +506,9 @@ struct opts_map_list_t : public option_t
     option_t( name ), _ref( ref )
   { }
 
+  bool prefix_match() const override
+  { return true; }
+
 protected:
   opts::parse_status parse( sim_t*, const std::string& n, const std::string& v ) const override
   {
@@ -613,6 +679,73 @@ opts::parse_status opts::parse( sim_t*                                        si
   return ret;
 }
 
+// option_index_t::sync =====================================================
+
+void opts::option_index_t::sync( const std::vector<std::unique_ptr<option_t>>& options )
+{
+  for ( ; indexed < options.size(); ++indexed )
+  {
+    if ( options[ indexed ]->prefix_match() )
+    {
+      prefix.push_back( indexed );
+    }
+    else
+    {
+      exact[ options[ indexed ]->name() ].push_back( indexed );
+    }
+  }
+}
+
+// option_t::parse ==========================================================
+
+opts::parse_status opts::parse( sim_t*                                        sim,
+                                const std::vector<std::unique_ptr<option_t>>& options,
+                                option_index_t&                               index,
+                                const std::string&                            name,
+                                const std::string&                            value,
+                                const parse_status_fn_t&                      status_fn )
+{
+  index.sync( options );
+
+  static const std::vector<size_t> no_match;
+  auto it = index.exact.find( name );
+  const auto& exact = it != index.exact.end() ? it->second : no_match;
+
+  // Merge exact and prefix candidates in list order
+  auto exact_it = exact.cbegin();
+  auto prefix_it = index.prefix.cbegin();
+  while ( exact_it != exact.cend() || prefix_it != index.prefix.cend() )
+  {
+    size_t position;
+    if ( prefix_it == index.prefix.cend() || ( exact_it != exact.cend() && *exact_it < *prefix_it ) )
+    {
+      position = *exact_it++;
+    }
+    else
+    {
+      position = *prefix_it++;
+    }
+
+    auto ret = options[ position ]->parse_option( sim, name, value );
+    if ( ret != parse_status::CONTINUE )
+    {
+      if ( status_fn )
+      {
+        ret = status_fn( ret, name, value );
+      }
+      return ret;
+    }
+  }
+
+  auto ret = parse_status::NOT_FOUND;
+  if ( status_fn )
+  {
+    ret = status_fn( parse_status::NOT_FOUND, name, value );
+  }
+
+  return ret;
+}
+
 // option_t::parse ==========================================================
 
 void opts::parse( sim_t*                                        sim,
@@ -658,40 +791,44 @@ void opts::parse( sim_t*                                        sim,
 
 bool option_db_t::parse_file( std::istream& input )
 {
-  std::string buffer;
-  bool first = true;
-  while ( input.good() )
+  // Read the whole input at once, lines are parsed in place
+  std::string buffer( ( std::istreambuf_iterator<char>( input ) ), std::istreambuf_iterator<char>() );
+
+  const char* first = buffer.data();
+  const char* end = buffer.data() + buffer.size();
+
+  // Skip the UTF-8 BOM, if any.
+  if ( buffer.size() >= 3 && utf8::is_bom( first ) )
   {
-    std::getline( input, buffer );
-    auto it = buffer.begin();
-    auto end = buffer.end();
-    if ( first )
-    {
-      first = false;
+    first += 3;
+  }
 
-      // Skip the UTF-8 BOM, if any.
-      size_t len = buffer.size();
-      if ( len >= 3 && utf8::is_bom( it ) )
-      {
-        it += 3;
-      }
-    }
+  while ( first != end )
+  {
+    const char* last = std::find( first, end, '\n' );
+    const char* next = last != end ? last + 1 : end;
 
-    while ( it != end && is_white_space( *it ) )
+    while ( first != last && is_white_space( *first ) )
     {
-      ++it;
+      ++first;
     }
 
-    if ( it == end || *it == '#' )
+    if ( first != last && *first != '#' )
     {
-      continue;
+      if ( utf8::is_valid( first, last ) )
+      {
+        parse_line( first, last );
+      }
+      else
+      {
+        auto line = io::maybe_latin1_to_utf8( std::string( first, last ) );
+        parse_line( line.data(), line.data() + line.size() );
+      }
     }
 
-    auto len = std::distance( buffer.begin(), it );
-    assert(len >= 0 && as<size_t>(len) <= buffer.size());
-    auto substring = buffer.substr(len);
-    parse_line( io::maybe_latin1_to_utf8( substring ) );
+    first = next;
   }
+
   return true;
 }
 
@@ -700,52 +837,46 @@ bool option_db_t::parse_file( std::istream& input )
 void option_db_t::parse_text( const std::string& text )
 {
   // Split a chunk of text into lines to parse.
-  std::string::size_type first = 0;
+  const char* first = text.data();
+  const char* end = text.data() + text.size();
 
   while ( true )
   {
-    while ( first < text.size() && is_white_space( text[ first ] ) )
+    while ( first != end && is_white_space( *first ) )
     {
       ++first;
     }
 
-    if ( first >= text.size() )
+    if ( first == end )
     {
       break;
     }
 
-    auto last = text.find( '\n', first );
-    if ( false )
-    {
-      std::cerr << "first = " << first << ", last = " << last << " ["
-                << text.substr( first, last - first ) << ']' << std::endl;
-    }
-    if ( text[ first ] != '#' )
+    const char* last = std::find( first, end, '\n' );
+    if ( *first != '#' )
     {
-      parse_line( text.substr( first, last - first ) );
+      parse_line( first, last );
     }
 
     first = last;
   }
-
 }
 
 // option_db_t::parse_line ==================================================
 
 void option_db_t::parse_line( const std::string& line )
 {
-  if ( line[ 0 ] == '#' )
-  {
-    return;
-  }
-
-  auto tokens = util::string_split_allow_quotes( line, " \t\n\r" );
+  parse_line( line.data(), line.data() + line.size() );
+}
 
-  for( const auto& token : tokens )
+void option_db_t::parse_line( const char* first, const char* last )
+{
+  if ( first == last || *first == '#' )
   {
-    parse_token( token );
+    return;
   }
 
+  split_tokens( first, last, [ this ]( const std::string& token ) { parse_token( token ); } );
 }
 
 // option_db_t::parse_token =================================================
@@ -758,18 +889,24 @@ void option_db_t::parse_token( const std::string& token )
     return;
   }
 
-  std::string parsed_token = token;
-  std::string::size_type cut_pt = parsed_token.find( '=' );
+  std::string::size_type cut_pt = token.find( '=' );
 
-  // Expand the token with template variables, and try to find '=' again
-  if ( cut_pt == std::string::npos )
+  // Expand the token with template variables, and try to find '=' again. The token is only copied
+  // if it needs expanding.
+  std::string expanded_token;
+  const std::string* parsed = &token;
+  if ( cut_pt == std::string::npos && token.find( "$(" ) != std::string::npos )
   {
-    do_replace( *this, parsed_token, parsed_token.find( "$(" ), 1 );
+    expanded_token = token;
+    expand_variables( *this, expanded_token );
+    parsed = &expanded_token;
 
-    cut_pt = parsed_token.find( "=" );
+    cut_pt = parsed -> find( '=' );
   }
 
-  if ( cut_pt == token.npos )
+  const std::string& parsed_token = *parsed;
+
+  if ( cut_pt == std::string::npos )
   {
     std::string actual_name;
     io::ifstream input;
@@ -784,7 +921,7 @@ void option_db_t::parse_token( const std::string& token )
 
   std::string name( parsed_token, 0, cut_pt ), value( parsed_token, cut_pt + 1, std::string::npos );
 
-  do_replace( *this, value, value.find( "$(" ), 1 );
+  expand_variables( *this, value );
 
   if ( name.size() >= 1 && name[ 0 ] == '$' )
   {
@@ -795,7 +932,7 @@ void option_db_t::parse_token( const std::string& token )
       throw std::invalid_argument( s.str() );
     }
     auto var_name = name.substr( 2, name.size() - 3 );
-    do_replace( *this, var_name, var_name.find( "$(" ), 1 );
+    expand_variables( *this, var_name );
     var_map[ var_name ] = value;
   }
   else if ( name == "input" )
@@ -828,7 +965,7 @@ void option_db_t::parse_token( const std::string& token )
   else
   {
     // Replace any template variable in the name portion of the option, if found
-    do_replace( *this, name, name.find( "$(" ), 1 );
+    expand_variables( *this, name );
 
     add( "global", name, value );
   }
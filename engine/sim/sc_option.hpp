@@ -51,8 +51,11 @@ public:
       std::throw_with_nested(std::runtime_error(fmt::format("Option '{}' with value '{}'", n, value)));
     }
   }
-  std::string name() const
+  const std::string& name() const
   { return _name; }
+  /// Option matches names that begin with its name (e.g. "name.key"), instead of the name only
+  virtual bool prefix_match() const
+  { return false; }
   std::ostream& print_option( std::ostream& stream ) const
   { return print( stream ); }
 protected:
@@ -71,7 +74,24 @@ typedef std::unordered_map<std::string, std::vector<std::string>> map_list_t;
 typedef std::function<bool(sim_t*,const std::string&, const std::string&)> function_t;
 typedef std::vector<std::string> list_t;
 
+/**
+ * Hashed index over an option list.
+ *
+ * Options matching their exact name are looked up by name hash, prefix-matched options are kept
+ * in a separate list. Candidates are tried in list order, which preserves the first-match
+ * semantics of a linear scan. Options appended to the list are indexed lazily on the next lookup.
+ */
+struct option_index_t
+{
+  std::unordered_map<std::string, std::vector<size_t>> exact;
+  std::vector<size_t> prefix;
+  size_t indexed = 0;
+
+  void sync( const std::vector<std::unique_ptr<option_t>>& options );
+};
+
 parse_status parse( sim_t*, const std::vector<std::unique_ptr<option_t>>&, const std::string& name, const std::string& value, const parse_status_fn_t& fn = nullptr );
+parse_status parse( sim_t*, const std::vector<std::unique_ptr<option_t>>&, option_index_t&, const std::string& name, const std::string& value, const parse_status_fn_t& fn = nullptr );
 void parse( sim_t*, const std::string& context, const std::vector<std::unique_ptr<option_t>>&, const std::string& options_str, const parse_status_fn_t& fn = nullptr );
 void parse( sim_t*, const std::string& context, const std::vector<std::unique_ptr<option_t>>&, const std::vector<std::string>& strings, const parse_status_fn_t& fn = nullptr );
 }
@@ -117,6 +137,7 @@ struct option_db_t : public std::vector<option_tuple_t>
   bool parse_file( std::istream& file );
   void parse_token( const std::string& token );
   void parse_line( const std::string& line );
+  void parse_line( const char* first, const char* last );
   void parse_text( const std::string& text );
   void parse_args( const std::vector<std::string>& args );
 };
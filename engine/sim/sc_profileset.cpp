@@ -656,6 +656,10 @@ void profilesets_t::initialize( sim_t* sim )
     return;
   }
 
+  // Profileset sims are parsed and initialized concurrently, so register the static data of all
+  // class modules before any of them run
+  sim -> startup_time += unique_gear::init_all_special_effects();
+
   if ( sim -> profileset_init_threads < 1 )
   {
     sim -> errorf( "No profileset init threads given, profilesets cannot continue" );
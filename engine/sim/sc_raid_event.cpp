@@ -235,12 +235,8 @@ struct adds_event_t : public raid_event_t
 
   void regenerate_cache()
   {
-    for ( auto p : affected_players )
-    {
-      // Invalidate target caches
-      for ( size_t i = 0, end = p->action_list.size(); i < end; i++ )
-        p->action_list[ i ]->target_cache.is_valid = false;  // Regenerate Cache.
-    }
+    // Invalidate target caches
+    ++sim->target_non_sleeping_epoch;
   }
 
   void _start() override
@@ -338,12 +334,8 @@ struct move_enemy_t : public raid_event_t
 
   void regenerate_cache()
   {
-    for ( auto p : affected_players )
-    {
-      // Invalidate target caches
-      for ( size_t i = 0, end = p->action_list.size(); i < end; i++ )
-        p->action_list[ i ]->target_cache.is_valid = false;  // Regenerate Cache.
-    }
+    // Invalidate target caches
+    ++sim->target_non_sleeping_epoch;
   }
 
   void reset() override
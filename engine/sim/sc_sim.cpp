@@ -1308,6 +1308,8 @@ sim_t::sim_t() :
   vary_combat_length( 0.0 ),
   current_iteration( -1 ),
   iterations( 0 ),
+  iteration_ordinal( 0 ),
+  reserved_iteration( -1 ),
   canceled( 0 ),
   target_error( 0 ),
   target_error_role( ROLE_DPS ),
@@ -1326,6 +1328,8 @@ sim_t::sim_t() :
   player_list(),
   player_no_pet_list(),
   player_non_sleeping_list(),
+  target_non_sleeping_epoch( 0 ),
+  player_non_sleeping_epoch( 0 ),
   active_player( nullptr ),
   current_index( 0 ),
   num_players( 0 ),
@@ -1356,6 +1360,12 @@ sim_t::sim_t() :
   save_talent_str( 0 ),
   talent_format( TALENT_FORMAT_UNCHANGED ),
   stat_cache( 1 ),
+  report_stat_cache( 0 ),
+  report_memory( 0 ),
+  memory_budget( 0 ),
+  memory_budget_level( 0 ),
+  child_memory_usage(),
+  coalesce_dot_ticks( false ),
   max_aoe_enemies( 20 ),
   show_etmi( 0 ),
   tmi_window_global( 0 ),
@@ -1371,7 +1381,7 @@ sim_t::sim_t() :
   pvp_crit( false ),
   auto_attacks_always_land( false ),
   active_enemies( 0 ), active_allies( 0 ),
-  _rng(), seed( 0 ), deterministic( 0 ), strict_work_queue( 0 ),
+  _rng(), seed( 0 ), base_seed( 0 ), deterministic( 0 ), strict_work_queue( 0 ),
   average_range( true ), average_gauss( false ),
   fight_style(), add_waves( 0 ), overrides( overrides_t() ),
   default_aura_delay( timespan_t::from_millis( 30 ) ),
@@ -1387,7 +1397,7 @@ sim_t::sim_t() :
   iteration_dmg( 0 ), priority_iteration_dmg( 0 ), iteration_heal( 0 ), iteration_absorb( 0 ),
   raid_dps(), total_dmg(), raid_hps(), total_heal(), total_absorb(), raid_aps(),
   simulation_length( "Simulation Length", false ),
-  merge_time( 0 ), init_time( 0 ), analyze_time( 0 ),
+  merge_time( 0 ), init_time( 0 ), analyze_time( 0 ), startup_time( 0 ),
   report_iteration_data( 0.025 ), min_report_iteration_data( -1 ),
   report_progress( 1 ),
   bloodlust_percent( 25 ), bloodlust_time( timespan_t::from_seconds( 0.5 ) ),
@@ -1395,8 +1405,9 @@ sim_t::sim_t() :
   report_precision(2), report_pets_separately( 0 ), report_targets( 1 ), report_details( 1 ), report_raw_abilities( 1 ),
   report_rng( 0 ), hosted_html( 0 ),
   save_raid_summary( 0 ), save_gear_comments( 0 ), statistics_level( 1 ), separate_stats_by_actions( 0 ), report_raid_summary( 0 ),
-  buff_uptime_timeline( 0 ), buff_stack_uptime_timeline( 0 ),
+  buff_uptime_timeline( 0 ), buff_stack_uptime_timeline( 0 ), buff_statistics_level( 2 ), record_action_sequence( false ),
   json_full_states( 0 ),
+  json_compact( 0 ),
   decorated_tooltips( -1 ),
   allow_potions( true ),
   allow_food( true ),
@@ -1458,6 +1469,9 @@ sim_t::sim_t( sim_t* p, int index ) : sim_t()
   // Inherit reporting directives from parent
   report_progress = parent -> report_progress;
 
+  // Collection fidelity is decided by the parent, merged data must be collected the same way
+  memory_budget_level = parent -> memory_budget_level;
+
   // Inherit 'plot' settings from parent because are set outside of the config file
   enchant = parent -> enchant;
 
@@ -1485,6 +1499,11 @@ sim_t::sim_t( sim_t* p, int index, sim_control_t* control ) : sim_t()
   // Inherit reporting directives from parent
   report_progress = parent -> report_progress;
 
+  // Collection fidelity is decided by the parent, merged data must be collected the same way. A
+  // parent with a memory budget settles the level in init(), and pushes it again when launching
+  // its children.
+  memory_budget_level = parent -> memory_budget_level;
+
   // Inherit 'plot' settings from parent because are set outside of the config file
   enchant = parent -> enchant;
 
@@ -1507,7 +1526,10 @@ sim_t::~sim_t()
 
 double sim_t::iteration_time_adjust() const
 {
-  if ( iterations <= 1 )
+  // Deterministic sims share one work queue between the threads, so the iteration count of the
+  // queue is the total, whereas iterations only holds this thread's share
+  int n_iterations = deterministic ? work_queue -> size() : iterations;
+  if ( n_iterations <= 1 )
     return 1.0;
 
   if ( current_iteration == 0 )
@@ -1522,6 +1544,13 @@ double sim_t::iteration_time_adjust() const
   {
     return rng().range( 1.0 - vary_combat_length, 1.0 + vary_combat_length );
   }
+  // Deterministic sims derive the adjustment from the iteration's position in the work queue, so an
+  // iteration gets the same fight length regardless of the thread that simulates it, or when
+  else if ( deterministic )
+  {
+    double pct = static_cast<double>( iteration_ordinal ) / n_iterations;
+    return 1.0 + vary_combat_length * ( ( ( iteration_ordinal + 1 ) % 2 ) ? 1 : -1 ) * pct;
+  }
   else
   {
     auto progress = work_queue -> progress();
@@ -1650,8 +1679,14 @@ void sim_t::reset()
   if ( debug )
     out_debug << "Resetting Simulator";
 
+  // Deterministic sims key the random stream of each iteration on the iteration's position in the
+  // work queue, so results do not depend on the thread count or which thread runs the iteration.
   if( deterministic )
-    seed = rng().reseed();
+  {
+    seed = rng::stream_seed( base_seed, ( uint64_t( current_index ) << 32 ) | unsigned( iteration_ordinal ) );
+    rng().seed( seed );
+    rng().reset();
+  }
 
   event_mgr.reset();
 
@@ -2479,14 +2514,30 @@ void sim_t::init()
       seed  = uint64_t(rd()) | (uint64_t(rd()) << 32);
     }
   }
-  _rng = rng::create( rng::parse_type( rng_str ) );
-  _rng -> seed( seed + thread_index );
+  base_seed = seed;
+
+  // Deterministic sims reseed at the start of every iteration, prefer the counter-based engine as
+  // it has no state initialization cost
+  if ( deterministic && rng_str.empty() )
+  {
+    _rng = rng::create( rng::engine_type::PHILOX );
+  }
+  else
+  {
+    _rng = rng::create( rng::parse_type( rng_str ) );
+  }
+  _rng -> seed( deterministic ? seed : seed + thread_index );
 
   if (   queue_lag_stddev == timespan_t::zero() )   queue_lag_stddev =   queue_lag * 0.25;
   if (     gcd_lag_stddev == timespan_t::zero() )     gcd_lag_stddev =     gcd_lag * 0.25;
   if ( channel_lag_stddev == timespan_t::zero() ) channel_lag_stddev = channel_lag * 0.25;
   if ( world_lag_stddev    < timespan_t::zero() ) world_lag_stddev   =   world_lag * 0.1;
 
+  // Action sequences are only rendered by the HTML and JSON reports of the main sim. Child sims
+  // (threads, profilesets, scaling) never report theirs.
+  record_action_sequence = ! parent &&
+                           ( ! html_file_str.empty() || ( ! json_file_str.empty() && report_details != 0 ) );
+
   confidence_estimator = rng::stdnormal_inv( 1.0 - ( 1.0 - confidence ) / 2.0 );
 
   if ( challenge_mode && scale_to_itemlevel < 0 )
@@ -2602,6 +2653,8 @@ void sim_t::init()
   // Initialize actors
   init_actors();
 
+  apply_memory_budget();
+
   if ( report_precision < 0 ) report_precision = 2;
 
   simulation_length.reserve( std::min( iterations, 10000 ) );
@@ -2756,6 +2809,15 @@ bool sim_t::iterate()
     return false;
   }
 
+  if ( settles_memory_budget() )
+  {
+    for ( auto& child : children )
+    {
+      child -> memory_budget_level = memory_budget_level;
+      child -> launch();
+    }
+  }
+
   progress_bar.init();
 
   activate_actors();
@@ -2763,6 +2825,11 @@ bool sim_t::iterate()
   bool more_work = true;
   do
   {
+    if ( deterministic && ! claim_iteration() )
+    {
+      break;
+    }
+
     ++current_iteration;
     ++work_done;
 
@@ -2777,21 +2844,19 @@ bool sim_t::iterate()
     auto old_active = current_index;
     if ( ! canceled )
     {
-      current_index = work_queue -> pop();
-      more_work = work_queue -> more_work();
-
-      if ( more_work && current_index != old_active )
+      if ( deterministic )
       {
-        if ( ! parent ||
-             scaling -> scale_stat != STAT_NONE ||
-             ( parent && parent -> reforge_plot -> current_stat_combo > -1 ) )
+        work_queue -> complete( current_index );
+      }
+      else
+      {
+        current_index = work_queue -> pop();
+        more_work = work_queue -> more_work();
+
+        if ( more_work && current_index != old_active )
         {
-          progress_bar.update( true, static_cast<int>( old_active ) );
-          progress_bar.output( true );
-          progress_bar.restart();
+          change_active_index( old_active );
         }
-
-        activate_actors();
       }
     }
   } while ( more_work && ! canceled );
@@ -2818,6 +2883,51 @@ bool sim_t::iterate()
   return iterations > 0;
 }
 
+/**
+ * @brief Claim the next iteration to simulate in a deterministic sim
+ *
+ * Each thread sim simulates its reserved first iteration, after which iterations are claimed from
+ * the shared work queue in order. Returns false when there is no more work.
+ */
+bool sim_t::claim_iteration()
+{
+  size_t index = current_index;
+
+  if ( reserved_iteration > -1 )
+  {
+    iteration_ordinal = reserved_iteration;
+    reserved_iteration = -1;
+  }
+  else if ( ! work_queue -> claim( index, iteration_ordinal ) )
+  {
+    return false;
+  }
+
+  if ( index != current_index )
+  {
+    auto old_active = current_index;
+    current_index = index;
+    change_active_index( old_active );
+  }
+
+  return true;
+}
+
+/// Finish progress reporting for the previous work index, and activate the actors of the new one
+void sim_t::change_active_index( size_t old_index )
+{
+  if ( ! parent ||
+       scaling -> scale_stat != STAT_NONE ||
+       ( parent && parent -> reforge_plot -> current_stat_combo > -1 ) )
+  {
+    progress_bar.update( true, static_cast<int>( old_index ) );
+    progress_bar.output( true );
+    progress_bar.restart();
+  }
+
+  activate_actors();
+}
+
 /**
  * @brief pause simulator
  *
@@ -2897,11 +3007,125 @@ void sim_t::merge( sim_t& other_sim )
   // than the parent
   spawner::merge( *this, other_sim );
 
+  if ( report_memory )
+  {
+    child_memory_usage.emplace_back( other_sim.thread_index, other_sim.memory_usage() );
+  }
+
   range::append( iteration_data, other_sim.iteration_data );
   merge_time += util::duration_fp_seconds( start );
   init_time += other_sim.init_time;
 }
 
+/// Approximate memory used by the actors and events of the sim, in bytes
+size_t sim_t::memory_usage() const
+{
+  size_t usage = event_mgr.memory_usage();
+
+  for ( const auto& actor : actor_list )
+  {
+    usage += actor -> memory_usage().total();
+  }
+
+  return usage;
+}
+
+/**
+ * Lower data collection fidelity if the projected memory usage exceeds memory_budget.
+ *
+ * The main sim picks the fidelity level from a projection based on the initialized actors, child
+ * sims inherit it. Every level drops the data that grows with the number of threads or iterations:
+ * level 1 drops per-ability and buff uptime timelines, level 2 additionally collects only
+ * sum/count/min/max for samples that are not reported as actor metrics.
+ */
+void sim_t::apply_memory_budget()
+{
+  if ( settles_memory_budget() )
+  {
+    auto budget = static_cast<size_t>( memory_budget * 1024 * 1024 );
+    auto n_threads = static_cast<size_t>( std::max( 1, threads ) );
+    auto bins = static_cast<size_t>( expected_max_time() ) + 1;
+
+    auto projected = [ & ]( int level ) {
+      size_t usage = 0;
+      for ( const auto& actor : actor_list )
+      {
+        const auto& d = actor -> collected_data;
+
+        size_t n_timelines = 3 + d.resource_timelines.size() + d.stat_timelines.size();
+        if ( d.health_changes.collect )
+          n_timelines += 6;
+
+        size_t n_samples = d.full_sample_count( level >= 2 );
+        if ( level < 2 && statistics_level >= 3 )
+          n_samples += 4 * actor -> stats_list.size();
+
+        if ( level < 1 )
+        {
+          n_timelines += range::count_if( actor -> stats_list, []( const stats_t* s ) {
+            return s -> timeline_amount != nullptr;
+          } );
+          if ( buff_uptime_timeline )
+            n_timelines += actor -> buff_list.size();
+        }
+
+        // Per-thread state and timelines, plus the full samples (and their sorted copies) of all
+        // iterations in the merged result
+        usage += n_threads * ( actor -> memory_usage().total() + n_timelines * bins * sizeof( double ) );
+        usage += n_samples * static_cast<size_t>( iterations ) * 2 * sizeof( double );
+      }
+      return usage;
+    };
+
+    while ( memory_budget_level < 2 && projected( memory_budget_level ) > budget )
+    {
+      ++memory_budget_level;
+    }
+
+    if ( memory_budget_level > 0 )
+    {
+      error( "Projected memory usage of {:.1f}MB exceeds memory_budget={:.1f}MB, lowering data collection fidelity to level {}.",
+             projected( 0 ) / ( 1024.0 * 1024.0 ), memory_budget, memory_budget_level );
+    }
+  }
+
+  if ( memory_budget_level >= 1 )
+  {
+    buff_uptime_timeline = 0;
+    buff_stack_uptime_timeline = 0;
+  }
+
+  if ( memory_budget_level >= 2 )
+  {
+    statistics_level = std::min( statistics_level, 1 );
+  }
+
+  if ( memory_budget_level == 0 )
+    return;
+
+  for ( auto& actor : actor_list )
+  {
+    for ( auto& s : actor -> stats_list )
+    {
+      s -> timeline_amount.reset();
+
+      if ( memory_budget_level >= 2 )
+      {
+        for ( auto sample : { &s -> actual_amount, &s -> total_amount, &s -> portion_aps, &s -> portion_apse } )
+        {
+          if ( ! sample -> simple )
+            sample -> change_mode( true );
+        }
+      }
+    }
+
+    if ( memory_budget_level >= 2 )
+    {
+      actor -> collected_data.simplify_auxiliary_samples();
+    }
+  }
+}
+
 /// merge all sims together
 void sim_t::merge()
 {
@@ -2961,19 +3185,30 @@ void sim_t::partition()
 
   thread::set_main_thread_priority();
 
+  // Every sim creates its enemies (and possibly actors of other classes) in init(), which runs in
+  // the simulator threads. Finish registering the special effect database on the main thread so
+  // that no thread mutates it while others read it.
+  startup_time += unique_gear::init_all_special_effects();
+
   merge_mutex.lock(); // parent sim is locked until parent merge() is called
 
   int remainder = iterations % threads;
   iterations /= threads;
 
-  // Normally we use a shared work-queue to ensure proper load balancing among threads.
-  // However, when we desire deterministic runs (for debugging) we need to force the
-  // sims to each use a specific number of iterations as opposed to using shared pool of work.
+  // Normally we use a shared work-queue to ensure proper load balancing among threads. Strict
+  // work queue forces the sims to each use a specific number of iterations instead. Deterministic
+  // sims use the shared queue as well, as the random stream of each iteration is keyed on its
+  // ordinal in the queue. Each thread gets its first iteration reserved up front.
 
-  if ( deterministic || strict_work_queue )
+  if ( strict_work_queue )
   {
     work_queue -> init( iterations );
   }
+  else if ( deterministic )
+  {
+    work_queue -> reserve( threads );
+    reserved_iteration = 0;
+  }
 
   int num_children = threads - 1;
 
@@ -3004,21 +3239,30 @@ void sim_t::partition()
       remainder--;
     }
 
-    if( deterministic || strict_work_queue )
+    if( strict_work_queue )
     {
       child -> work_queue -> init( child -> iterations );
     }
     else // share the work queue
     {
       child -> work_queue = work_queue;
+      if ( deterministic )
+      {
+        child -> reserved_iteration = i + 1;
+      }
     }
     child -> report_progress = 0;
   }
 
   computer_process::set_priority( process_priority ); // Set main thread priority
 
-  for ( auto & child : children )
-    child -> launch();
+  // With a memory budget, the children are launched by iterate() once init() has settled the
+  // data collection fidelity level
+  if ( ! settles_memory_budget() )
+  {
+    for ( auto & child : children )
+      child -> launch();
+  }
 
   // Safe to do for now, since control is only referenced by sim_t::setup, which is called in the
   // sim_t constructor.
@@ -3082,7 +3326,7 @@ cooldown_t* sim_t::get_cooldown( const std::string& name )
       return c;
   }
 
-  c = new cooldown_t( name, *this );
+  c = arena.create<cooldown_t>( name, *this );
 
   cooldown_list.push_back( c );
 
@@ -3330,6 +3574,9 @@ void sim_t::create_options()
   add_option( opt_func( "item_db_source", parse_item_sources ) );
   add_option( opt_func( "proxy", parse_proxy ) );
   add_option( opt_int( "stat_cache", stat_cache ) );
+  add_option( opt_bool( "report_stat_cache", report_stat_cache ) );
+  add_option( opt_bool( "report_memory", report_memory ) );
+  add_option( opt_float( "memory_budget", memory_budget, 0, std::numeric_limits<double>::max() ) );
   add_option( opt_int( "max_aoe_enemies", max_aoe_enemies ) );
   add_option( opt_bool( "optimize_expressions", optimize_expressions ) );
   add_option( opt_bool( "single_actor_batch", single_actor_batch ) );
@@ -3382,7 +3629,9 @@ void sim_t::create_options()
   add_option( opt_bool( "save_gear_comments", save_gear_comments ) );
   add_option( opt_bool( "buff_uptime_timeline", buff_uptime_timeline ) );
   add_option( opt_bool( "buff_stack_uptime_timeline", buff_stack_uptime_timeline ) );
+  add_option( opt_int( "buff_statistics_level", buff_statistics_level, 0, 2 ) );
   add_option( opt_bool( "json_full_states", json_full_states ) );
+  add_option( opt_bool( "json_compact", json_compact ) );
   // Bloodlust
   add_option( opt_int( "bloodlust_percent", bloodlust_percent ) );
   add_option( opt_timespan( "bloodlust_time", bloodlust_time ) );
@@ -3409,6 +3658,7 @@ void sim_t::create_options()
   add_option( opt_float( "wheel_granularity", event_mgr.wheel_granularity ) );
   add_option( opt_int( "wheel_seconds", event_mgr.wheel_seconds ) );
   add_option( opt_int( "wheel_shift", event_mgr.wheel_shift ) );
+  add_option( opt_bool( "coalesce_dot_ticks", coalesce_dot_ticks ) );
   add_option( opt_string( "reference_player", reference_player_str ) );
   add_option( opt_string( "raid_events", raid_events_str ) );
   add_option( opt_append( "raid_events+", raid_events_str ) );
@@ -3664,7 +3914,7 @@ bool sim_t::parse_option( const std::string& name,
 {
   if ( active_player )
   {
-    auto ret = opts::parse( this, active_player->options, name, value );
+    auto ret = opts::parse( this, active_player->options, active_player->option_index, name, value );
 
     // Bail out early on player-specific option error states
     switch ( ret )
@@ -3679,7 +3929,7 @@ bool sim_t::parse_option( const std::string& name,
     }
   }
 
-  auto ret = opts::parse( this, options, name, value );
+  auto ret = opts::parse( this, options, option_index, name, value );
   // With strict_parsing enabled, anything else than "ok" parse status will result in hard failure
   if ( strict_parsing && ret != opts::parse_status::OK )
   {
@@ -3741,7 +3991,7 @@ void sim_t::setup( sim_control_t* c )
                     o.scope, o.name, o.value));
     }
 
-    auto ret = opts::parse( this, p->options, o.name, o.value );
+    auto ret = opts::parse( this, p->options, p->option_index, o.name, o.value );
     if ( ret == opts::parse_status::FAILURE )
     {
       throw std::invalid_argument(fmt::format("Unable to parse option '{}' with value '{}' for player '{}'.",
@@ -3853,7 +4103,7 @@ sim_progress_t sim_t::progress( std::string* detailed, int index )
   }
 
   // For work queues that are independent, collect all work done so far for the progressbar.
-  if ( deterministic || strict_work_queue )
+  if ( strict_work_queue )
   {
     AUTO_LOCK( relatives_mutex );
     for ( const auto& child : children )
@@ -4125,6 +4375,9 @@ void sim_t::activate_actors()
   healing_no_pet_list.reset_callbacks();
   healing_pet_list.reset_callbacks();
 
+  target_non_sleeping_list.register_callback( [ this ]( player_t* ) { ++target_non_sleeping_epoch; } );
+  player_non_sleeping_list.register_callback( [ this ]( player_t* ) { ++player_non_sleeping_epoch; } );
+
   // Normal sim mode activates all actors .. and this method is only called once at the beginning of
   // the simulation run.
   if ( ! single_actor_batch )
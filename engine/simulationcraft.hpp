@@ -80,6 +80,7 @@ struct cooldown_t;
 struct cost_reduction_buff_t;
 class dbc_t;
 struct dot_t;
+struct dot_tick_batch_event_t;
 struct event_t;
 struct expr_t;
 struct gain_t;
@@ -137,6 +138,9 @@ namespace highchart {
 // Sample Data
 #include "util/sample_data.hpp"
 
+// Per sim/actor object arena
+#include "util/arena.hpp"
+
 // Timeline
 #include "util/timeline.hpp"
 
@@ -941,6 +945,7 @@ struct event_manager_t
   void init();
   void reset();
   void merge( event_manager_t& other );
+  size_t memory_usage() const;
 };
 
 // Simulation Engine ========================================================
@@ -967,6 +972,7 @@ struct sim_t : private sc_thread_t
   timespan_t max_time, expected_iteration_time;
   double vary_combat_length;
   int current_iteration, iterations;
+  int iteration_ordinal, reserved_iteration; // Work queue ordinal of the current iteration (deterministic sims)
   bool canceled;
   double target_error;
   role_e target_error_role;
@@ -989,6 +995,9 @@ struct sim_t : private sc_thread_t
   vector_with_callback<player_t*> player_non_sleeping_list;
   vector_with_callback<player_t*> healing_no_pet_list;
   vector_with_callback<player_t*> healing_pet_list;
+  // Bumped whenever the respective non-sleeping list changes. Action target caches record the epoch
+  // they were built at, so invalidation is a single increment instead of a walk over all actions.
+  unsigned    target_non_sleeping_epoch, player_non_sleeping_epoch;
   player_t*   active_player;
   size_t      current_index; // Current active player
   int         num_players;
@@ -1024,6 +1033,14 @@ struct sim_t : private sc_thread_t
   auto_dispose< std::vector<player_t*> > actor_list;
   std::string main_target_str;
   int         stat_cache;
+  int         report_stat_cache;
+  // Approximate memory accounting, reported with report_memory=1. A non-zero memory_budget (in MB)
+  // lowers data collection fidelity up front if the projected usage of the simulation exceeds it.
+  int         report_memory;
+  double      memory_budget;
+  int         memory_budget_level; // 0: full fidelity, 1: no ability/buff timelines, 2: also simple auxiliary samples
+  std::vector<std::pair<int, size_t>> child_memory_usage; // thread index, bytes of merged child sims
+  bool        coalesce_dot_ticks;
   int         max_aoe_enemies;
   bool        show_etmi;
   double      tmi_window_global;
@@ -1069,6 +1086,7 @@ struct sim_t : private sc_thread_t
   int active_allies;
 
   std::vector<std::unique_ptr<option_t>> options;
+  opts::option_index_t option_index;
   std::vector<std::string> party_encoding;
   std::vector<std::string> item_db_sources;
 
@@ -1076,6 +1094,7 @@ struct sim_t : private sc_thread_t
   std::unique_ptr<rng::rng_t> _rng;
   std::string rng_str;
   uint64_t seed;
+  uint64_t base_seed; // Seed used to derive per-iteration streams in deterministic sims
   int deterministic;
   int strict_work_queue;
   int average_range, average_gauss;
@@ -1232,7 +1251,9 @@ struct sim_t : private sc_thread_t
   timespan_t default_aura_delay;
   timespan_t default_aura_delay_stddev;
 
-  auto_dispose<std::vector<cooldown_t*>> cooldown_list;
+  // Owns the sim-wide cooldowns, declared before the list so it outlives it
+  util::arena_t arena;
+  std::vector<cooldown_t*> cooldown_list;
 
   /// Status of azerite-related effects
   azerite_control azerite_status;
@@ -1250,6 +1271,7 @@ struct sim_t : private sc_thread_t
   simple_sample_data_t raid_dps, total_dmg, raid_hps, total_heal, total_absorb, raid_aps;
   extended_sample_data_t simulation_length;
   double merge_time, init_time, analyze_time;
+  double startup_time; // Static data, hotfix and lazy class module registration, in wall seconds
   // Deterministic simulation iteration data collectors for specific iteration
   // replayability
   std::vector<iteration_data_entry_t> iteration_data, low_iteration_data, high_iteration_data;
@@ -1290,7 +1312,10 @@ struct sim_t : private sc_thread_t
   int report_raid_summary;
   int buff_uptime_timeline;
   int buff_stack_uptime_timeline;
+  int buff_statistics_level; // 0: uptime only, 1: adds trigger/benefit/count stats, 2: adds per-stack uptimes and intervals
+  bool record_action_sequence; // Sample action sequence is collected for reporting
   int json_full_states;
+  int json_compact;
   int decorated_tooltips;
 
   int allow_potions;
@@ -1329,15 +1354,15 @@ struct sim_t : private sc_thread_t
     using G = nop;
 #endif
     public:
-    std::vector<int> _total_work, _work, _projected_work;
+    std::vector<int> _total_work, _work, _projected_work, _claimed;
     size_t index;
 
     work_queue_t() : index( 0 )
-    { _total_work.resize( 1 ); _work.resize( 1 ); _projected_work.resize( 1 ); }
+    { _total_work.resize( 1 ); _work.resize( 1 ); _projected_work.resize( 1 ); _claimed.resize( 1 ); }
 
-    void init( int w )    { G l(m); range::fill( _total_work, w ); range::fill( _projected_work, w ); }
+    void init( int w )    { G l(m); range::fill( _total_work, w ); range::fill( _projected_work, w ); range::fill( _claimed, 0 ); }
     // Single actor batch sim init methods. Batches is the number of active actors
-    void batches( size_t n ) { G l(m); _total_work.resize( n ); _work.resize( n ); _projected_work.resize( n ); }
+    void batches( size_t n ) { G l(m); _total_work.resize( n ); _work.resize( n ); _projected_work.resize( n ); _claimed.resize( n ); }
 
     void flush()          { G l(m); _total_work[ index ] = _projected_work[ index ] = _work[ index ]; }
     int  size()           { G l(m); return index < _total_work.size() ? _total_work[ index ] : _total_work.back(); }
@@ -1384,6 +1409,41 @@ struct sim_t : private sc_thread_t
       return index;
     }
 
+    // Deterministic sims claim each iteration before simulating it. Iterations are handed out in
+    // order, identified by the work index and their ordinal within it, regardless of the thread
+    // that claims them. Returns false once all work has been handed out.
+    bool claim( size_t& idx, int& ordinal )
+    {
+      G l(m);
+
+      while ( _claimed[ index ] >= _total_work[ index ] )
+      {
+        if ( index == _claimed.size() - 1 )
+        {
+          return false;
+        }
+        ++index;
+      }
+
+      idx = index;
+      ordinal = _claimed[ index ]++;
+      return true;
+    }
+
+    // Hand out the first n ordinals of the current index outside claim(), used to give each
+    // thread sim its first iteration up front
+    void reserve( int n ) { G l(m); _claimed[ index ] = std::max( _claimed[ index ], n ); }
+
+    // Claim counterpart of pop(), accounts for a finished iteration of work index idx
+    void complete( size_t idx )
+    {
+      G l(m);
+      if ( ++_work[ idx ] == _total_work[ idx ] )
+      {
+        _projected_work[ idx ] = _work[ idx ];
+      }
+    }
+
     // Standard progress method, normal mode sims use the single (first) index, single actor batch
     // sims progress with the main thread's current index.
     sim_progress_t progress( int idx = -1 )
@@ -1477,6 +1537,10 @@ struct sim_t : private sc_thread_t
   void      analyze();
   void      merge( sim_t& other_sim );
   void      merge();
+  size_t    memory_usage() const;
+  void      apply_memory_budget();
+  bool      settles_memory_budget() const
+  { return ! parent && memory_budget > 0; }
   bool      iterate();
   void      partition();
   bool      execute();
@@ -1593,6 +1657,8 @@ struct sim_t : private sc_thread_t
 
 private:
   void do_pause();
+  bool claim_iteration();
+  void change_active_index( size_t old_index );
   void print_spell_query();
   void enable_debug_seed();
   void disable_debug_seed();
@@ -1661,6 +1727,9 @@ struct module_t
   {
     return get( util::parse_player_type( n ) );
   }
+  // Hotfixes are registered for all modules up front, as they are applied before any actor exists.
+  // Module static data (static_init()) is registered lazily on the first actor of the class, see
+  // unique_gear::init_special_effects().
   static void init()
   {
     for ( player_e i = PLAYER_NONE; i < PLAYER_MAX; i++ )
@@ -1668,7 +1737,6 @@ struct module_t
       const module_t* m = get( i );
       if ( m )
       {
-        m -> static_init();
         m -> register_hotfixes();
       }
     }
@@ -2793,13 +2861,19 @@ private:
   timespan_t   last_successful_trigger;
   unsigned     scales_with;
   blp          blp_state;
+  // Stat scaling coefficient, cached until one of the scaling stat cache entries changes
+  double       coeff;
+  uint64_t     coeff_generation;
 
   real_ppm_t() : player( nullptr ), freq( 0 ), modifier( 0 ), rppm( 0 ), scales_with( 0 ),
-    blp_state( BLP_ENABLED )
+    blp_state( BLP_ENABLED ), coeff( 1.0 ), coeff_generation( invalid_generation() )
   { }
 
   static double max_interval() { return 10.0; }
   static double max_bad_luck_prot() { return 1000.0; }
+  static uint64_t invalid_generation() { return std::numeric_limits<uint64_t>::max(); }
+
+  double scaling_coefficient();
 public:
   static double proc_chance( player_t*         player,
                              double            PPM,
@@ -2817,13 +2891,15 @@ public:
     last_trigger_attempt( timespan_t::zero() ),
     last_successful_trigger( timespan_t::zero() ),
     scales_with( s ),
-    blp_state( b )
+    blp_state( b ),
+    coeff( 1.0 ),
+    coeff_generation( invalid_generation() )
   { }
 
   real_ppm_t( const std::string& name, player_t* p, const spell_data_t* data = spell_data_t::nil(), const item_t* item = nullptr );
 
   void set_scaling( unsigned s )
-  { scales_with = s; }
+  { scales_with = s; coeff_generation = invalid_generation(); }
 
   void set_modifier( double mod )
   { modifier = mod; rppm = freq * modifier; }
@@ -3045,7 +3121,20 @@ struct effect_callbacks_t
 
   proc_array_t procs;
 
-  effect_callbacks_t( sim_t* sim ) : sim( sim )
+  // Flattened dispatch tables, compiled from procs on the first trigger after callback
+  // registration changes. Callbacks that expose their trigger cooldown are rejected in the
+  // dispatch loop while the cooldown is down, without a virtual trigger() call.
+  struct dispatch_entry_t
+  {
+    T_CB* cb;
+    const cooldown_t* cooldown;
+  };
+  typedef std::array<std::array<std::vector<dispatch_entry_t>, PROC2_TYPE_MAX>, PROC1_TYPE_MAX> dispatch_array_t;
+
+  dispatch_array_t dispatch;
+  bool compiled;
+
+  effect_callbacks_t( sim_t* sim ) : sim( sim ), compiled( false )
   { }
 
   bool has_callback( const std::function<bool(const T_CB*)> cmp ) const
@@ -3057,8 +3146,11 @@ struct effect_callbacks_t
   void reset();
 
   void register_callback( unsigned proc_flags, unsigned proc_flags2, T_CB* cb );
+
+  void trigger( proc_types pt, proc_types2 pt2, action_t* a, action_state_t* state );
 private:
   void add_proc_callback( proc_types type, unsigned flags, T_CB* cb );
+  void compile();
 };
 
 // Stat Cache
@@ -3092,6 +3184,11 @@ struct player_stat_cache_t
   mutable std::array<bool, CACHE_MAX> valid;
   mutable std::array < bool, SCHOOL_MAX + 1 > spell_power_valid, player_mult_valid, player_heal_mult_valid;
   // 'valid'-states
+  // Per-entry statistics. The generation of an entry is bumped on every invalidation, allowing
+  // dependent state to detect changes without being notified. Accesses and misses (recomputations)
+  // are reported with report_stat_cache=1.
+  std::array<uint64_t, CACHE_MAX> generation;
+  mutable std::array<uint64_t, CACHE_MAX> accesses, misses;
 private:
   // cached values
   mutable double _strength, _agility, _stamina, _intellect, _spirit;
@@ -3111,8 +3208,11 @@ public:
   bool active; // runtime active-flag
   void invalidate_all();
   void invalidate( cache_e );
+  void merge( const player_stat_cache_t& other );
   double get_attribute( attribute_e ) const;
-  player_stat_cache_t( const player_t* p ) : player( p ), active( false ) { invalidate_all(); }
+  player_stat_cache_t( const player_t* p ) :
+    player( p ), generation(), accesses(), misses(), active( false )
+  { invalidate_all(); }
 #if defined(SC_USE_STAT_CACHE)
   // Cache stat functions
   double strength() const;
@@ -3203,6 +3303,18 @@ struct player_processed_report_information_t
 
 };
 
+/// Approximate per-actor memory usage in bytes, split by subsystem
+struct actor_memory_usage_t
+{
+  size_t collected_data = 0;
+  size_t stats = 0;
+  size_t buffs = 0;
+  size_t timelines = 0;
+
+  size_t total() const
+  { return collected_data + stats + buffs + timelines; }
+};
+
 /* Contains any data collected during / at the end of combat
  * Mostly statistical data collection, represented as sample data containers
  */
@@ -3340,12 +3452,14 @@ struct player_collected_data_t
 
   player_collected_data_t( const player_t* player );
   void reserve_memory( const player_t& );
+  size_t full_sample_count( bool metrics_only ) const;
+  void simplify_auxiliary_samples();
   void merge( const player_t& );
   void analyze( const player_t& );
   void collect_data( const player_t& );
   void print_tmi_debug_csv( const sc_timeline_t* nma, const std::vector<double>& weighted_value, const player_t& p );
-  double calculate_tmi( const health_changes_timeline_t& tl, int window, double f_length, const player_t& p );
-  double calculate_max_spike_damage( const health_changes_timeline_t& tl, int window );
+  double calculate_tmi( const sc_timeline_t& sliding_average, int window, double bin_size, double f_length, const player_t& p );
+  double calculate_max_spike_damage( const sc_timeline_t& sliding_average, int window );
   std::ostream& data_str( std::ostream& s ) const;
 
 };
@@ -3537,6 +3651,141 @@ namespace assessor
 
 // Player ===================================================================
 
+/**
+ * @brief Hashed name index over a list of named objects.
+ *
+ * Objects appended to the indexed list are picked up lazily on the next lookup, so the
+ * owning list can keep being populated directly. Each name maps to all objects of that name
+ * in list order, which preserves the first-match semantics of a linear scan. Keys point to the
+ * name of the first object of each name instead of copying it, so objects that are already
+ * indexed must be renamed through rename().
+ */
+template <typename T>
+struct name_index_t
+{
+  struct key_hash_t
+  {
+    size_t operator()( const std::string* name ) const
+    { return std::hash<std::string>()( *name ); }
+  };
+
+  struct key_equal_t
+  {
+    bool operator()( const std::string* l, const std::string* r ) const
+    { return *l == *r; }
+  };
+
+  std::unordered_map<const std::string*, std::vector<T*>, key_hash_t, key_equal_t> index;
+  size_t indexed = 0;
+
+  void sync( const std::vector<T*>& list )
+  {
+    // The list shrank behind the index's back, start over
+    if ( list.size() < indexed )
+    {
+      index.clear();
+      indexed = 0;
+    }
+
+    for ( ; indexed < list.size(); ++indexed )
+    {
+      index[ &list[ indexed ]->name_str ].push_back( list[ indexed ] );
+    }
+  }
+
+  template <typename Predicate>
+  T* find( const std::vector<T*>& list, const std::string& name, Predicate pred )
+  {
+    sync( list );
+
+    auto it = index.find( &name );
+    if ( it == index.end() )
+    {
+      return nullptr;
+    }
+
+    for ( T* obj : it->second )
+    {
+      if ( pred( obj ) )
+      {
+        return obj;
+      }
+    }
+
+    return nullptr;
+  }
+
+  T* find( const std::vector<T*>& list, const std::string& name )
+  { return find( list, name, []( const T* ) { return true; } ); }
+
+  // Remove an object from the list, keeping the index in sync. Returns true if it was found.
+  bool erase( std::vector<T*>& list, T* obj )
+  {
+    auto it = range::find( list, obj );
+    if ( it == list.end() )
+    {
+      return false;
+    }
+
+    if ( static_cast<size_t>( it - list.begin() ) < indexed )
+    {
+      unindex( obj );
+      --indexed;
+    }
+
+    list.erase( it );
+    return true;
+  }
+
+  // Rename an object of the list, keeping the index in sync
+  void rename( const std::vector<T*>& list, T* obj, const std::string& name )
+  {
+    auto pos = range::find( list, obj );
+    if ( pos == list.end() || static_cast<size_t>( pos - list.begin() ) >= indexed )
+    {
+      // Not indexed yet, sync() picks up the new name
+      obj->name_str = name;
+      return;
+    }
+
+    unindex( obj );
+    obj->name_str = name;
+
+    // Objects of the same name stay in list order
+    auto& entries = index[ &obj->name_str ];
+    auto it = std::find_if( entries.begin(), entries.end(), [ &list, pos ]( T* other ) {
+      return range::find( list, other ) > pos;
+    } );
+    entries.insert( it, obj );
+  }
+
+private:
+  // Remove an object from the index. If it provided the key of its name, the key is moved to the
+  // next object of that name.
+  void unindex( T* obj )
+  {
+    auto it = index.find( &obj->name_str );
+    if ( it == index.end() )
+    {
+      return;
+    }
+
+    auto entries = std::move( it->second );
+    index.erase( it );
+
+    auto entry = range::find( entries, obj );
+    if ( entry != entries.end() )
+    {
+      entries.erase( entry );
+    }
+
+    if ( ! entries.empty() )
+    {
+      index.emplace( &entries.front()->name_str, std::move( entries ) );
+    }
+  }
+};
+
 struct action_variable_t
 {
   std::string name_;
@@ -3701,7 +3950,7 @@ struct player_t : public actor_t
   timespan_t started_waiting;
   std::vector<pet_t*> pet_list;
   std::vector<pet_t*> active_pets;
-  std::vector<absorb_buff_t*> absorb_buff_list;
+  std::vector<absorb_buff_t*> absorb_buff_list; // Active absorbs in consumption order, maintained by absorb_buff_t::start()
   std::map<unsigned,instant_absorb_t> instant_absorb_list;
 
   int         invert_scaling;
@@ -3719,6 +3968,7 @@ struct player_t : public actor_t
 
   // Option Parsing
   std::vector<std::unique_ptr<option_t>> options;
+  opts::option_index_t option_index;
 
   // Stat Timelines to Display
   std::vector<stat_e> stat_timelines;
@@ -3839,7 +4089,12 @@ struct player_t : public actor_t
   std::string modify_action;
   std::string use_apl;
   bool use_default_action_list;
-  auto_dispose< std::vector<dot_t*> > dot_list;
+  // Owns the objects created by the get_*() factories (dots, procs, gains, stats, benefits,
+  // uptimes, cooldowns, rppm, shuffled rng, sample data). Declared before their lists so it
+  // outlives them.
+  util::arena_t arena;
+  std::vector<dot_t*> dot_list;
+  std::vector<dot_tick_batch_event_t*> dot_tick_batches; // Pending coalesced tick events of dots applied by this actor
   auto_dispose< std::vector<action_priority_list_t*> > action_priority_list;
   std::vector<action_t*> precombat_action_list;
   action_priority_list_t* active_action_list;
@@ -3864,18 +4119,28 @@ struct player_t : public actor_t
   double tmi_window;
 
   auto_dispose< std::vector<buff_t*> > buff_list;
-  auto_dispose< std::vector<proc_t*> > proc_list;
-  auto_dispose< std::vector<gain_t*> > gain_list;
-  auto_dispose< std::vector<stats_t*> > stats_list;
-  auto_dispose< std::vector<benefit_t*> > benefit_list;
-  auto_dispose< std::vector<uptime_t*> > uptime_list;
-  auto_dispose< std::vector<cooldown_t*> > cooldown_list;
-  auto_dispose< std::vector<real_ppm_t*> > rppm_list;
-  auto_dispose< std::vector<shuffled_rng_t*> > shuffled_rng_list;
+  std::vector<buff_t*> dirty_buff_list; // Buffs that changed state during the current iteration
+  std::vector<proc_t*> proc_list;
+  std::vector<gain_t*> gain_list;
+  std::vector<stats_t*> stats_list;
+  std::vector<benefit_t*> benefit_list;
+  std::vector<uptime_t*> uptime_list;
+  std::vector<cooldown_t*> cooldown_list;
+  std::vector<real_ppm_t*> rppm_list;
+  std::vector<shuffled_rng_t*> shuffled_rng_list;
   std::vector<cooldown_t*> dynamic_cooldown_list;
   std::array< std::vector<plot_data_t>, STAT_MAX > dps_plot_data;
   std::vector<std::vector<plot_data_t> > reforge_plot_data;
-  auto_dispose< std::vector<luxurious_sample_data_t*> > sample_data_list;
+  std::vector<luxurious_sample_data_t*> sample_data_list;
+
+  // Hashed name lookups into the object lists above
+  mutable name_index_t<action_t> action_index;
+  mutable name_index_t<buff_t> buff_index;
+  mutable name_index_t<dot_t> dot_index;
+  mutable name_index_t<proc_t> proc_index;
+  mutable name_index_t<gain_t> gain_index;
+  mutable name_index_t<stats_t> stats_index;
+  mutable name_index_t<cooldown_t> cooldown_index;
 
   // All Data collected during / end of combat
   player_collected_data_t collected_data;
@@ -4369,6 +4634,7 @@ public:
   virtual void merge( player_t& other );
   virtual void datacollection_begin();
   virtual void datacollection_end();
+  actor_memory_usage_t memory_usage() const;
 
   /// Single actor batch mode calls this every time the active (player) actor changes for all targets
   virtual void actor_changed() { }
@@ -5551,7 +5817,7 @@ public:
   expr_t* early_chain_if_expr;
   expr_t* cancel_if_expr;
   action_t* sync_action;
-  std::string signature_str;
+  util::shared_text_t signature_str; // Shared with the APL line (action_priority_t) it came from
   target_specific_t<dot_t> target_specific_dot;
   action_priority_list_t* action_list;
 
@@ -5588,21 +5854,47 @@ public:
   /**
    * Target Cache System
    * - list: contains the cached target pointers
-   * - callback: unique_Ptr to callback
-   * - is_valid: gets invalidated by the callback from the target list source.
+   * - is_valid: explicit invalidation flag, for action-specific reasons to rebuild the list
+   * - source_epoch: points to the sim epoch of the actor list the targets are drawn from
+   * - epoch: source epoch the list was built at. The cache is stale if the sim epoch moved on.
    *  When the target list is requested in action_t::target_list(), it gets recalculated if
-   *  flag is false, otherwise cached version is used
+   *  the cache is not valid, otherwise cached version is used
    */
   struct target_cache_t {
     std::vector< player_t* > list;
     bool is_valid;
-    target_cache_t() : is_valid( false ) {}
+    const unsigned* source_epoch;
+    unsigned epoch;
+    target_cache_t() : is_valid( false ), source_epoch( nullptr ), epoch( 0 ) {}
+
+    bool valid() const
+    { return is_valid && ( ! source_epoch || epoch == *source_epoch ); }
+
+    void validate()
+    {
+      is_valid = true;
+      if ( source_epoch )
+        epoch = *source_epoch;
+    }
   } mutable target_cache;
 
 private:
   std::vector<std::unique_ptr<option_t>> options;
   action_state_t* state_cache;
   std::vector<travel_event_t*> travel_events;
+
+  /**
+   * Batched aoe execution
+   * - shared_snapshot: player-side state that does not depend on the target (crit, haste, attack
+   *   and spell power), snapshotted once per aoe execute and reused for all targets
+   * - aoe_states: scratch buffer holding the per-target states until they are dispatched
+   */
+  struct shared_snapshot_t {
+    unsigned flags;
+    double crit_chance, haste, attack_power, spell_power;
+    shared_snapshot_t() : flags( 0 ), crit_chance( 0 ), haste( 0 ), attack_power( 0 ), spell_power( 0 ) {}
+  } shared_snapshot;
+  std::vector<action_state_t*> aoe_states;
 public:
   action_t( action_e type, const std::string& token, player_t* p, const spell_data_t* s = spell_data_t::nil() );
 
@@ -5790,7 +6082,7 @@ public:
 
   virtual bool execute_targeting( action_t* action ) const;
 
-  virtual std::vector<player_t*> targets_in_range_list( std::vector< player_t* >& tl ) const;
+  virtual std::vector<player_t*>& targets_in_range_list( std::vector< player_t* >& tl ) const;
 
   virtual std::vector<player_t*>& check_distance_targeting( std::vector< player_t* >& tl ) const;
 
@@ -6070,6 +6362,9 @@ public:
 
   virtual void init_finished();
 
+  /// Change the name of the action, keeping the player's action lookup in sync
+  void rename( const std::string& name );
+
   virtual void reset();
 
   virtual void cancel();
@@ -6605,6 +6900,27 @@ private:
   dot_t* dot;
 };
 
+// DoT Tick Batch Event =====================================================
+
+// With coalesce_dot_ticks=1, all ticks of a source's dots due on the same timestamp share one
+// event. Ticks are dispatched in the order they were scheduled.
+struct dot_tick_batch_event_t : public event_t
+{
+public:
+  dot_tick_batch_event_t( player_t* source, timespan_t time_to_tick );
+  ~dot_tick_batch_event_t();
+
+private:
+  virtual void execute() override;
+  virtual const char* name() const override
+  { return "DoT Tick Batch"; }
+  player_t* source;
+  std::vector<dot_t*> dots;
+  bool executing;
+
+  friend struct dot_t;
+};
+
 struct dot_t : private noncopyable
 {
 private:
@@ -6637,6 +6953,8 @@ public:
   void   extend_duration( timespan_t extra_seconds, uint32_t state_flags )
   { extend_duration( extra_seconds, timespan_t::min(), state_flags ); }
   void   reduce_duration( timespan_t remove_seconds, uint32_t state_flags = -1 );
+  // Delay the next tick and the end of the dot, without changing the remaining ticks
+  void   delay_tick( timespan_t delay );
   void   refresh_duration( uint32_t state_flags = -1 );
   void   reset();
   void   cancel();
@@ -6684,6 +7002,9 @@ public:
 private:
   void tick_zero();
   void schedule_tick();
+  void schedule_tick_event( timespan_t time_to_tick );
+  void cancel_tick_event();
+  void execute_tick();
   void start( timespan_t duration );
   void refresh( timespan_t duration );
   void check_tick_zero( bool start );
@@ -6692,6 +7013,7 @@ private:
 
   friend struct dot_tick_event_t;
   friend struct dot_end_event_t;
+  friend struct dot_tick_batch_event_t;
 };
 
 inline double action_t::last_tick_factor( const dot_t* /* d */, const timespan_t& time_to_tick, const timespan_t& duration ) const
@@ -6710,40 +7032,45 @@ inline dot_tick_event_t::dot_tick_event_t( dot_t* d, timespan_t time_to_tick ) :
 inline void dot_tick_event_t::execute()
 {
   dot -> tick_event = nullptr;
-  dot -> current_tick++;
+  dot -> execute_tick();
+}
 
-  if ( dot -> current_action -> channeled &&
-       dot -> current_action -> action_skill < 1.0 &&
-       dot -> remains() >= dot -> current_action -> tick_time( dot -> state ) )
+inline void dot_t::execute_tick()
+{
+  current_tick++;
+
+  if ( current_action -> channeled &&
+       current_action -> action_skill < 1.0 &&
+       remains() >= current_action -> tick_time( state ) )
   {
-    if ( rng().roll( std::max( 0.0, dot -> current_action -> action_skill - dot -> current_action -> player -> current.skill_debuff ) ) )
+    if ( sim.rng().roll( std::max( 0.0, current_action -> action_skill - current_action -> player -> current.skill_debuff ) ) )
     {
-      dot -> tick();
+      tick();
     }
   }
   else // No skill-check required
   {
-    dot -> tick();
+    tick();
   }
 
   // Some dots actually cancel themselves mid-tick. If this happens, we presume
   // that the cancel has been "proper", and just stop event execution here, as
   // the dot no longer exists.
-  if ( ! dot -> is_ticking() )
+  if ( ! is_ticking() )
     return;
 
-  if ( ! dot -> current_action -> consume_cost_per_tick( *dot ) )
+  if ( ! current_action -> consume_cost_per_tick( *this ) )
   {
     return;
   }
 
-  if ( dot -> channel_interrupt() )
+  if ( channel_interrupt() )
   {
     return;
   }
 
   // continue ticking
-  dot->schedule_tick();
+  schedule_tick();
 }
 
 inline dot_end_event_t::dot_end_event_t( dot_t* d, timespan_t time_to_end ) :
@@ -6802,6 +7129,10 @@ struct action_callback_t : private noncopyable
   virtual void activate() { active = true; }
   virtual void deactivate() { active = false; }
 
+  // Cooldown that unconditionally blocks trigger(), if any. Lets the proc dispatch skip the
+  // virtual trigger() call while the cooldown is down.
+  virtual const cooldown_t* trigger_cooldown() const { return nullptr; }
+
   static void trigger( const std::vector<action_callback_t*>& v, action_t* a, void* call_data = nullptr )
   {
     if ( a && ! a -> player -> in_combat ) return;
@@ -6912,6 +7243,8 @@ struct dbc_proc_callback_t : public action_callback_t
 
   virtual void initialize() override;
 
+  const cooldown_t* trigger_cooldown() const override;
+
   void trigger( action_t* a, void* call_data ) override
   {
     if ( cooldown && cooldown -> down() ) return;
@@ -7043,17 +7376,19 @@ protected:
 
 // Action Priority List =====================================================
 
+// APL line text is immutable once parsed and shared by all sims of the process (see
+// util::share_text), only the owning list is per actor.
 struct action_priority_t
 {
-  std::string action_;
-  std::string comment_;
+  util::shared_text_t action_;
+  util::shared_text_t comment_;
 
   action_priority_t( const std::string& a, const std::string& c ) :
-    action_( a ), comment_( c )
+    action_( util::share_text( a ) ), comment_( util::share_text( c ) )
   { }
 
   action_priority_t* comment( const std::string& c )
-  { comment_ = c; return this; }
+  { comment_ = util::share_text( c ); return this; }
 };
 
 struct action_priority_list_t
@@ -7496,6 +7831,8 @@ void register_special_effects_legion(); // Legion special effects
 void register_special_effects_bfa(); // Battle for Azeroth special effects
 void sort_special_effects();
 void unregister_special_effects();
+double init_special_effects( player_e type );
+double init_all_special_effects();
 
 void add_effect( const special_effect_db_item_t& );
 special_effect_set_t find_special_effect_db_item( unsigned spell_id );
@@ -8131,7 +8468,9 @@ inline real_ppm_t::real_ppm_t( const std::string& name, player_t* p, const spell
   last_trigger_attempt( timespan_t::zero() ),
   last_successful_trigger( timespan_t::zero() ),
   scales_with( p -> dbc.real_ppm_scale( data -> id() ) ),
-  blp_state( BLP_ENABLED )
+  blp_state( BLP_ENABLED ),
+  coeff( 1.0 ),
+  coeff_generation( invalid_generation() )
 { }
 
 inline double real_ppm_t::proc_chance( player_t*         player,
@@ -8186,6 +8525,51 @@ inline double real_ppm_t::proc_chance( player_t*         player,
   return rppm_chance;
 }
 
+/**
+ * Stat scaling coefficient of the proc, computed identically to proc_chance(). With an active stat
+ * cache, the coefficient is only recomputed when the generation of one of the scaling cache
+ * entries changes. Generations only ever increase, so their sum identifies the cached state.
+ */
+inline double real_ppm_t::scaling_coefficient()
+{
+  if ( scales_with == RPPM_NONE )
+  {
+    return 1.0;
+  }
+
+  const auto& cache = player->cache;
+  if ( cache.active )
+  {
+    uint64_t generation = 0;
+    if ( scales_with & RPPM_HASTE )
+      generation += cache.generation[ CACHE_RPPM_HASTE ];
+    if ( scales_with & RPPM_CRIT )
+      generation += cache.generation[ CACHE_RPPM_CRIT ];
+    if ( scales_with & RPPM_ATTACK_SPEED )
+      generation += cache.generation[ CACHE_ATTACK_SPEED ];
+
+    if ( generation == coeff_generation )
+    {
+      return coeff;
+    }
+
+    coeff_generation = generation;
+  }
+
+  coeff = 1.0;
+
+  if ( scales_with & RPPM_HASTE )
+    coeff *= cache.rppm_haste_coeff();
+
+  if ( scales_with & RPPM_CRIT )
+    coeff *= cache.rppm_crit_coeff();
+
+  if ( scales_with & RPPM_ATTACK_SPEED )
+    coeff *= 1.0 / cache.attack_speed();
+
+  return coeff;
+}
+
 inline bool real_ppm_t::trigger()
 {
   if ( freq <= 0 )
@@ -8193,11 +8577,32 @@ inline bool real_ppm_t::trigger()
     return false;
   }
 
-  if ( last_trigger_attempt == player->sim->current_time() )
+  auto sim = player->sim;
+  if ( last_trigger_attempt == sim->current_time() )
     return false;
 
-  double chance = proc_chance( player, rppm, last_trigger_attempt, last_successful_trigger,
-      scales_with, blp_state );
+  double chance;
+  if ( sim->debug )
+  {
+    chance = proc_chance( player, rppm, last_trigger_attempt, last_successful_trigger,
+        scales_with, blp_state );
+  }
+  // Same arithmetic as proc_chance(), with the stat scaling coefficient cached
+  else
+  {
+    double real_ppm = rppm * scaling_coefficient();
+    double seconds = std::min( ( sim->current_time() - last_trigger_attempt ).total_seconds(), max_interval() );
+    chance = real_ppm * ( seconds / 60.0 );
+
+    if ( blp_state == BLP_ENABLED )
+    {
+      double last_success = std::min( ( sim->current_time() - last_successful_trigger ).total_seconds(), max_bad_luck_prot() );
+      double expected_average_proc_interval = 60.0 / real_ppm;
+
+      chance = std::max( 1.0, 1 + ( ( last_success / expected_average_proc_interval - 1.5 ) * 3.0 ) ) * chance;
+    }
+  }
+
   bool success = player->rng().roll( chance );
 
   last_trigger_attempt = player->sim->current_time();
@@ -8769,6 +9174,8 @@ void effect_callbacks_t<T_CB>::register_callback( unsigned proc_flags,
   // they need to be non-zero
   assert( proc_flags != 0 && cb != 0 );
 
+  compiled = false;
+
   if ( sim -> debug )
     sim -> out_debug.printf( "Registering callback proc_flags=%#.8x proc_flags2=%#.8x",
         proc_flags, proc_flags2 );
@@ -8853,6 +9260,60 @@ void effect_callbacks_t<T_CB>::reset()
   T_CB::reset( all_callbacks );
 }
 
+template <typename T_CB>
+void effect_callbacks_t<T_CB>::compile()
+{
+  for ( size_t pt = 0; pt < procs.size(); ++pt )
+  {
+    for ( size_t pt2 = 0; pt2 < procs[ pt ].size(); ++pt2 )
+    {
+      auto& entries = dispatch[ pt ][ pt2 ];
+      entries.clear();
+      entries.reserve( procs[ pt ][ pt2 ].size() );
+      for ( T_CB* cb : procs[ pt ][ pt2 ] )
+      {
+        entries.push_back( dispatch_entry_t{ cb, cb->trigger_cooldown() } );
+      }
+    }
+  }
+
+  compiled = true;
+}
+
+template <typename T_CB>
+void effect_callbacks_t<T_CB>::trigger( proc_types pt, proc_types2 pt2, action_t* a, action_state_t* state )
+{
+  if ( a && ! a->player->in_combat ) return;
+
+  if ( ! compiled )
+  {
+    compile();
+  }
+
+  // Index based, as a nested trigger may recompile (and reallocate) the table. Callbacks
+  // registered during dispatch are appended, and are not triggered by this event.
+  const auto& entries = dispatch[ pt ][ pt2 ];
+  size_t size = entries.size();
+  for ( size_t i = 0; i < size; ++i )
+  {
+    const dispatch_entry_t& entry = entries[ i ];
+    T_CB* cb = entry.cb;
+    if ( ! cb->active )
+    {
+      continue;
+    }
+
+    if ( ! cb->allow_procs && a && a->proc ) return;
+
+    if ( entry.cooldown && entry.cooldown->down() )
+    {
+      continue;
+    }
+
+    cb->trigger( a, state );
+  }
+}
+
 /**
  * Targetdata initializer for items. When targetdata is constructed (due to a call to
  * player_t::get_target_data failing to find an object for the given target), all targetdata
@@ -0,0 +1,124 @@
+// ==========================================================================
+// Dedmonwakeen's Raid DPS/TPS Simulator.
+// Send questions to natehieter@gmail.com
+// ==========================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "util/generic.hpp"
+
+namespace util
+{
+/**
+ * Monotonic object arena.
+ *
+ * Objects are constructed into large blocks through a bump pointer, so objects created together
+ * (e.g., the cooldowns, gains and stats of one actor) sit next to each other in memory. Nothing is
+ * freed individually. Destroying the arena runs the destructors of its objects in reverse order of
+ * creation, and releases the blocks in one go.
+ *
+ * Not thread safe, an arena belongs to a single sim (thread).
+ */
+class arena_t : private noncopyable
+{
+  struct object_t
+  {
+    void* ptr;
+    void ( *destroy )( void* );
+  };
+
+  size_t block_size_;
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  std::vector<object_t> objects_;
+  char* cursor_;
+  char* end_;
+  size_t allocated_;
+
+  template <typename T>
+  static void destroy( void* ptr )
+  { static_cast<T*>( ptr ) -> ~T(); }
+
+  static char* align_ptr( char* ptr, size_t align )
+  {
+    auto addr = reinterpret_cast<std::uintptr_t>( ptr );
+    return ptr + ( align - addr % align ) % align;
+  }
+
+  char* new_block( size_t size )
+  {
+    blocks_.emplace_back( new char[ size ] );
+    allocated_ += size;
+    return blocks_.back().get();
+  }
+
+public:
+  explicit arena_t( size_t block_size = 32 * 1024 ) :
+    block_size_( block_size ), cursor_( nullptr ), end_( nullptr ), allocated_( 0 )
+  { }
+
+  ~arena_t()
+  { clear(); }
+
+  /// Raw, uninitialized storage that lives as long as the arena
+  void* allocate( size_t size, size_t align = alignof( std::max_align_t ) )
+  {
+    // Large requests get a dedicated block, so the current block keeps being filled
+    if ( size + align > block_size_ / 4 )
+    {
+      return align_ptr( new_block( size + align ), align );
+    }
+
+    char* ptr = cursor_ ? align_ptr( cursor_, align ) : nullptr;
+    if ( ptr == nullptr || ptr + size > end_ )
+    {
+      cursor_ = new_block( block_size_ );
+      end_ = cursor_ + block_size_;
+      ptr = align_ptr( cursor_, align );
+    }
+
+    cursor_ = ptr + size;
+
+    return ptr;
+  }
+
+  /// Construct an object owned by the arena. The object must not be deleted by the caller.
+  template <typename T, typename... Args>
+  T* create( Args&&... args )
+  {
+    void* ptr = allocate( sizeof( T ), alignof( T ) );
+    T* object = new ( ptr ) T( std::forward<Args>( args )... );
+
+    if ( ! std::is_trivially_destructible<T>::value )
+    {
+      objects_.push_back( { object, &destroy<T> } );
+    }
+
+    return object;
+  }
+
+  /// Destroy all objects and release all memory
+  void clear()
+  {
+    for ( auto it = objects_.rbegin(); it != objects_.rend(); ++it )
+    {
+      it -> destroy( it -> ptr );
+    }
+
+    objects_.clear();
+    blocks_.clear();
+    cursor_ = end_ = nullptr;
+    allocated_ = 0;
+  }
+
+  size_t memory_usage() const
+  { return allocated_ + objects_.capacity() * sizeof( object_t ); }
+};
+} // namespace util
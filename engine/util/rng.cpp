@@ -244,6 +244,91 @@ struct rng_xorshift1024_t : public rng_t
 };
 
 
+/**
+ * @brief Philox-4x32-10 counter-based Random Number Generator
+ *
+ * Output is a pure function of ( key, counter ), so a stream can be positioned anywhere by
+ * (re)seeding it, without any state initialization cost. This makes it the natural engine for
+ * deterministic simulations, which rekey the stream at the start of every iteration.
+ *
+ * Salmon, Moraes, Dror, Shaw: "Parallel random numbers: as easy as 1, 2, 3" (SC11)
+ * http://www.thesalmons.org/john/random123/
+ */
+struct rng_philox_t : public rng_t
+{
+  static const uint32_t PHILOX_M0 = 0xD2511F53;
+  static const uint32_t PHILOX_M1 = 0xCD9E8D57;
+  static const uint32_t PHILOX_W0 = 0x9E3779B9;
+  static const uint32_t PHILOX_W1 = 0xBB67AE85;
+
+  uint32_t key[ 2 ];
+  uint32_t ctr[ 4 ];
+  uint64_t out[ 2 ];
+  unsigned idx;
+
+  static void block( uint32_t c[ 4 ], const uint32_t k_[ 2 ] )
+  {
+    uint32_t k[ 2 ] = { k_[ 0 ], k_[ 1 ] };
+    for ( int round = 0; round < 10; round++ )
+    {
+      uint64_t p0 = uint64_t( PHILOX_M0 ) * c[ 0 ];
+      uint64_t p1 = uint64_t( PHILOX_M1 ) * c[ 2 ];
+      uint32_t c0 = uint32_t( p1 >> 32 ) ^ c[ 1 ] ^ k[ 0 ];
+      uint32_t c2 = uint32_t( p0 >> 32 ) ^ c[ 3 ] ^ k[ 1 ];
+      c[ 1 ] = uint32_t( p1 );
+      c[ 3 ] = uint32_t( p0 );
+      c[ 0 ] = c0;
+      c[ 2 ] = c2;
+      k[ 0 ] += PHILOX_W0;
+      k[ 1 ] += PHILOX_W1;
+    }
+  }
+
+  /// Single block evaluation, 64 bits of output for ( key, counter )
+  static uint64_t hash( uint64_t k, uint64_t counter )
+  {
+    uint32_t kk[ 2 ] = { uint32_t( k ), uint32_t( k >> 32 ) };
+    uint32_t c[ 4 ] = { uint32_t( counter ), uint32_t( counter >> 32 ), 0, 0 };
+    block( c, kk );
+    return uint64_t( c[ 0 ] ) | ( uint64_t( c[ 1 ] ) << 32 );
+  }
+
+  void next_block()
+  {
+    uint32_t c[ 4 ] = { ctr[ 0 ], ctr[ 1 ], ctr[ 2 ], ctr[ 3 ] };
+    block( c, key );
+    out[ 0 ] = uint64_t( c[ 0 ] ) | ( uint64_t( c[ 1 ] ) << 32 );
+    out[ 1 ] = uint64_t( c[ 2 ] ) | ( uint64_t( c[ 3 ] ) << 32 );
+    idx = 0;
+
+    // 128-bit counter increment
+    for ( auto& elem : ctr )
+    {
+      if ( ++elem != 0 )
+        break;
+    }
+  }
+
+  virtual const char* name() const override { return "philox"; }
+
+  virtual void seed( uint64_t start ) override
+  {
+    key[ 0 ] = uint32_t( start );
+    key[ 1 ] = uint32_t( start >> 32 );
+    for ( auto& elem : ctr ) elem = 0;
+    idx = 2;
+  }
+
+  virtual double real() override
+  {
+    if ( idx == 2 )
+      next_block();
+
+    return convert_to_double_0_1( out[ idx++ ] );
+  }
+};
+
+
 /**
  * @brief SIMD oriented Fast Mersenne Twister(SFMT) pseudorandom number generator
  *
@@ -768,6 +853,7 @@ rng_t::rng_t() :
 engine_type parse_type( const std::string& n )
 {
   if( n == "murmurhash"   ) return engine_type::MURMURHASH;
+  if( n == "philox"       ) return engine_type::PHILOX;
   if( n == "sfmt"         ) return engine_type::SFMT;
   if( n == "std"          ) return engine_type::STD;
   if( n == "tinymt"       ) return engine_type::TINYMT;
@@ -788,6 +874,9 @@ std::unique_ptr<rng_t> create( engine_type t )
   case engine_type::MURMURHASH:
     return std::unique_ptr<rng_t>(new rng_murmurhash_t());
 
+  case engine_type::PHILOX:
+    return std::unique_ptr<rng_t>(new rng_philox_t());
+
   case engine_type::STD:
     return std::unique_ptr<rng_t>(new rng_mt_cxx11_t());
 
@@ -814,6 +903,17 @@ std::unique_ptr<rng_t> create( engine_type t )
   return create( engine_type::SFMT );
 }
 
+/**
+ * Derive the seed of an independent random stream from a base seed and a stream index.
+ *
+ * The result only depends on its arguments, which allows deterministic simulations to key the
+ * randomness of each iteration on the iteration's ordinal, instead of on the thread simulating it.
+ */
+uint64_t stream_seed( uint64_t seed, uint64_t stream )
+{
+  return rng_philox_t::hash( seed, stream );
+}
+
 /**
  * @brief The standard normal CDF, for one random variable.
  *
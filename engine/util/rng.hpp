@@ -20,7 +20,7 @@ namespace rng {
 
 /// rng engines
 enum class engine_type {
-  DEFAULT, MURMURHASH, SFMT, STD, TINYMT, XORSHIFT64, XORSHIFT128, XORSHIFT1024
+  DEFAULT, MURMURHASH, PHILOX, SFMT, STD, TINYMT, XORSHIFT64, XORSHIFT128, XORSHIFT1024
 };
 
 /**\ingroup SC_RNG
@@ -75,6 +75,7 @@ private:
 
 std::unique_ptr<rng_t> create( engine_type = engine_type::DEFAULT );
 engine_type parse_type( const std::string& name );
+uint64_t stream_seed( uint64_t seed, uint64_t stream );
 
 double stdnormal_cdf( double );
 double stdnormal_inv( double );
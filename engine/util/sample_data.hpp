@@ -375,6 +375,13 @@ public:
     this->simple = simple;
 
     clear();
+
+    // Release any storage reserved for the full data set
+    if ( simple )
+    {
+      std::vector<value_t>().swap( _data );
+      std::vector<value_t>().swap( _sorted_data );
+    }
   }
 
   const char* name() const
@@ -389,6 +396,13 @@ public:
       _data.reserve( capacity );
   }
 
+  // Approximate heap usage of the collected data, in bytes
+  std::size_t memory_usage() const
+  {
+    return ( _data.capacity() + _sorted_data.capacity() ) * sizeof( value_t ) +
+           distribution.capacity() * sizeof( size_t );
+  }
+
   // Add a sample
   void add( value_t x )
   {
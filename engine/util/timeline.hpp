@@ -94,6 +94,10 @@ public:
   void resize( size_t length )
   { _data.resize( length ); }
 
+  // Approximate heap usage of the timeline, in bytes
+  size_t memory_usage() const
+  { return _data.capacity() * sizeof( double ); }
+
   // Add 'value' at the specific index
   void add( size_t index, double value )
   {
@@ -62,8 +62,6 @@ int main( int argc, char *argv[] )
   dbc::init();
   module_t::init();
   unique_gear::register_hotfixes();
-  unique_gear::register_special_effects();
-  unique_gear::sort_special_effects();
   
   #ifndef SC_NO_NETWORKING
   bcp_api::token_load();
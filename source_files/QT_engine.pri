@@ -7,6 +7,7 @@
  HEADERS += engine/util/stopwatch.hpp
  HEADERS += engine/util/sc_resourcepaths.hpp
  HEADERS += engine/util/sample_data.hpp
+ HEADERS += engine/util/arena.hpp
  HEADERS += engine/util/rng.hpp
  HEADERS += engine/util/io.hpp
  HEADERS += engine/util/generic.hpp
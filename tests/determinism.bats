@@ -0,0 +1,25 @@
+load test_helper
+
+# Mean DPS (rounded, merged sums depend on the thread count by floating point rounding) and the
+# DPS range (exact, depends on the extreme iterations only) of every actor in the output
+function dps_summary() {
+  echo "${output}" | awk '/^  DPS=/ {
+    split($1, mean, "="); split($3, range, "[=/]");
+    printf "%.3f %s\n", mean[2], range[2]
+  }'
+}
+
+@test "Deterministic results do not depend on the thread count" {
+  sim threads=1 deterministic=1 target_error=0
+  [ "${status}" -eq 0 ]
+  SINGLE_THREAD="$(dps_summary)"
+  [ -n "${SINGLE_THREAD}" ]
+
+  sim threads=4 deterministic=1 target_error=0
+  [ "${status}" -eq 0 ]
+  [ "$(dps_summary)" == "${SINGLE_THREAD}" ]
+
+  sim threads=4 deterministic=1 target_error=0
+  [ "${status}" -eq 0 ]
+  [ "$(dps_summary)" == "${SINGLE_THREAD}" ]
+}